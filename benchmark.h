@@ -0,0 +1,313 @@
+// Benchmark harness shared by all four programs.
+// Every program registers its solvers and runs them with "--bench" over the
+// same matrix of generated graphs, so rows from different programs line up:
+//
+//   <program> --bench [--format csv|json] [--graphs path,cycle,grid,tree,gnm,...]
+//                     [--sizes 100,1000,...] [--warmup W] [--reps N]
+//                     [--seed S] [--no-header]
+//
+// Only the solver call is timed, with a monotonic clock. Graph generation,
+// cover checking and output happen outside the measured region. Each row
+// reports min / median / p99 wall time over the repetitions, the cover sizes
+// seen and the ratio of the largest one to the best known cover size.
+// Built with -DVC_INSTRUMENT, JSON rows also carry the counters of the
+// measured repetitions (see instrument.h), with the solve and verify phases.
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "graph.h"
+#include "generators.h"
+#include "bipartite.h"
+
+typedef struct BenchSolver {
+    const char* name;
+    bool* (*solve)(Graph* graph);  // new cover array, or NULL when the solver does not apply
+    int maxVertices;               // larger graphs are skipped, 0 = no limit
+} BenchSolver;
+
+typedef struct BenchWorkload {
+    char name[64];
+    Graph* graph;
+    int reference;   // best known cover size
+    bool optimal;    // reference is the optimum, otherwise the LP lower bound
+} BenchWorkload;
+
+typedef struct BenchOptions {
+    bool json;
+    bool header;
+    int warmup;
+    int reps;
+    uint64_t seed;
+    const char* graphs;
+    const char* sizes;
+} BenchOptions;
+
+static inline double benchNow(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+// --- workloads ---
+
+// ceil of the LP relaxation, a lower bound on any vertex cover
+static inline int benchLowerBound(Graph* graph) {
+    int bound;
+    free(lpVertexCover(graph, &bound));
+    return bound;
+}
+
+// Optimum of a generated random tree, whose edge v - 1 joins v to a parent
+// with a smaller id: take the parent of every uncovered leaf, deepest first.
+static inline int benchTreeOptimum(const Graph* graph) {
+    bool* taken = (bool*)calloc(graph->numVertices + 1, sizeof(bool));
+    if (taken == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int optimum = 0;
+    for (int64_t i = graph->numEdges - 1; i >= 0; i--) {
+        int parent = graph->edges[i].u;
+        int child = graph->edges[i].v;
+        if (!taken[child] && !taken[parent]) {
+            taken[parent] = true;
+            optimum++;
+        }
+    }
+    free(taken);
+    return optimum;
+}
+
+static inline bool benchKnownFamily(const char* family) {
+    GraphFamily generated;
+    return strcmp(family, "path") == 0 || strcmp(family, "cycle") == 0 || parseGraphFamily(family, &generated);
+}
+
+// Build one workload, returns false for an unknown family or when the
+// generator rejects the parameters (it prints why)
+static inline bool benchMakeWorkload(const char* family, int n, uint64_t seed, BenchWorkload* workload) {
+    workload->optimal = true;
+    if (strcmp(family, "path") == 0) {
+        workload->graph = createGraph(n, n);
+        for (int v = 0; v + 1 < n; v++) {
+            addEdge(workload->graph, v, v + 1);
+        }
+        workload->reference = n / 2;
+    } else if (strcmp(family, "cycle") == 0) {
+        workload->graph = createGraph(n, n);
+        for (int v = 0; v < n && n > 2; v++) {
+            addEdge(workload->graph, v, (v + 1) % n);
+        }
+        workload->reference = n > 2 ? (n + 1) / 2 : n / 2;
+    } else {
+        GraphFamily generated;
+        if (!parseGraphFamily(family, &generated)) return false;
+        GeneratorSpec spec;
+        defaultGeneratorSpec(&spec, generated, n, seed ^ genMix((uint64_t)n));
+        workload->graph = generateGraph(&spec, 0);
+        if (workload->graph == NULL) return false;
+        n = workload->graph->numVertices;
+        if (generated == GEN_GRID) {
+            // bipartite with a matching that leaves at most one vertex free
+            workload->reference = n / 2;
+        } else if (generated == GEN_TREE) {
+            workload->reference = benchTreeOptimum(workload->graph);
+        } else {
+            // Konig gives the optimum of bipartite families, the LP bound is all we have otherwise
+            bool* cover = bipartiteVertexCover(workload->graph);
+            if (cover != NULL) {
+                workload->reference = 0;
+                for (int v = 0; v < n; v++) {
+                    if (cover[v]) workload->reference++;
+                }
+                free(cover);
+            } else {
+                workload->reference = benchLowerBound(workload->graph);
+                workload->optimal = false;
+            }
+        }
+    }
+    snprintf(workload->name, sizeof(workload->name), "%s-%d", family, n);
+    return true;
+}
+
+// --- measurement ---
+
+static inline int benchCompareDoubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// cover size, or -1 if some edge is left uncovered
+static inline int benchCheckCover(const Graph* graph, const bool* cover) {
+    for (int64_t i = 0; i < graph->numEdges; i++) {
+        if (!cover[graph->edges[i].u] && !cover[graph->edges[i].v]) return -1;
+    }
+    int size = 0;
+    for (int v = 0; v < graph->numVertices; v++) {
+        if (cover[v]) size++;
+    }
+    return size;
+}
+
+static inline void benchPrintHeader(const BenchOptions* options) {
+    if (!options->json && options->header) {
+        printf("program,solver,graph,vertices,edges,warmup,reps,min_s,median_s,p99_s,"
+               "cover_min,cover_max,reference,reference_kind,ratio,valid\n");
+    }
+}
+
+// Warm up, time the repetitions and print one row
+static inline void benchRun(const char* program, const BenchSolver* solver, const BenchWorkload* workload,
+                            const BenchOptions* options) {
+    Graph* graph = workload->graph;
+    double* times = (double*)malloc(options->reps * sizeof(double));
+    if (times == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    int coverMin = -1, coverMax = -1;
+    bool valid = true;
+    for (int run = 0; run < options->warmup + options->reps; run++) {
+        if (run == options->warmup) instrumentReset();
+        INSTR_PHASE_BEGIN(PHASE_SOLVE);
+        double start = benchNow();
+        bool* cover = solver->solve(graph);
+        double elapsed = benchNow() - start;
+        INSTR_PHASE_END(PHASE_SOLVE);
+        if (cover == NULL) {
+            free(times);
+            return;  // not applicable to this graph
+        }
+        INSTR_PHASE_BEGIN(PHASE_VERIFY);
+        int size = benchCheckCover(graph, cover);
+        INSTR_PHASE_END(PHASE_VERIFY);
+        free(cover);
+        if (size < 0) {
+            fprintf(stderr, "%s %s: invalid cover on %s\n", program, solver->name, workload->name);
+            valid = false;
+        }
+        if (run < options->warmup) continue;
+        times[run - options->warmup] = elapsed;
+        if (coverMin < 0 || size < coverMin) coverMin = size;
+        if (size > coverMax) coverMax = size;
+    }
+
+    qsort(times, options->reps, sizeof(double), benchCompareDoubles);
+    int reps = options->reps;
+    double median = reps % 2 ? times[reps / 2] : (times[reps / 2 - 1] + times[reps / 2]) / 2;
+    double p99 = times[(99 * reps + 99) / 100 - 1];  // nearest rank: ceil(0.99 * reps)
+    double ratio = workload->reference > 0 ? (double)coverMax / workload->reference : 1.0;
+    const char* kind = workload->optimal ? "optimum" : "lower_bound";
+
+    if (options->json) {
+        printf("{\"program\":\"%s\",\"solver\":\"%s\",\"graph\":\"%s\",\"vertices\":%d,\"edges\":%lld,"
+               "\"warmup\":%d,\"reps\":%d,\"min_s\":%.9f,\"median_s\":%.9f,\"p99_s\":%.9f,"
+               "\"cover_min\":%d,\"cover_max\":%d,\"reference\":%d,\"reference_kind\":\"%s\","
+               "\"ratio\":%.6f,\"valid\":%s",
+               program, solver->name, workload->name, graph->numVertices, (long long)graph->numEdges,
+               options->warmup, reps, times[0], median, p99, coverMin, coverMax, workload->reference,
+               kind, ratio, valid ? "true" : "false");
+#ifdef VC_INSTRUMENT
+        printf(",\"stats\":{");
+        instrumentWriteFields(stdout);
+        printf("}");
+#endif
+        printf("}\n");
+    } else {
+        printf("%s,%s,%s,%d,%lld,%d,%d,%.9f,%.9f,%.9f,%d,%d,%d,%s,%.6f,%s\n",
+               program, solver->name, workload->name, graph->numVertices, (long long)graph->numEdges,
+               options->warmup, reps, times[0], median, p99, coverMin, coverMax, workload->reference,
+               kind, ratio, valid ? "true" : "false");
+    }
+    fflush(stdout);
+    free(times);
+}
+
+// Parse the options after "--bench" and run every solver on every workload.
+// Returns the process exit status.
+static inline int runBenchmarks(const char* program, const BenchSolver* solvers, int numSolvers,
+                                int argc, char* argv[]) {
+    BenchOptions options = {false, true, 1, 10, 142, "path,cycle,grid,tree,gnm,ba,rmat", "100,1000,10000,100000"};
+    for (int i = 0; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--format") == 0 && hasValue) {
+            options.json = strcmp(argv[++i], "json") == 0;
+        } else if (strcmp(argv[i], "--graphs") == 0 && hasValue) {
+            options.graphs = argv[++i];
+        } else if (strcmp(argv[i], "--sizes") == 0 && hasValue) {
+            options.sizes = argv[++i];
+        } else if (strcmp(argv[i], "--warmup") == 0 && hasValue) {
+            options.warmup = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--reps") == 0 && hasValue) {
+            options.reps = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options.seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--no-header") == 0) {
+            options.header = false;
+        } else {
+            fprintf(stderr, "Unknown benchmark option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (options.warmup < 0) options.warmup = 0;
+    if (options.reps < 1) options.reps = 1;
+
+    benchPrintHeader(&options);
+
+    // walk the comma separated family and size lists
+    const char* family = options.graphs;
+    while (*family) {
+        size_t familyLength = strcspn(family, ",");
+        char familyName[32];
+        snprintf(familyName, sizeof(familyName), "%.*s", (int)familyLength, family);
+        if (!benchKnownFamily(familyName)) {
+            fprintf(stderr, "Unknown graph family: %s\n", familyName);
+            return 1;
+        }
+
+        const char* size = options.sizes;
+        while (*size) {
+            int n = atoi(size);
+            BenchWorkload workload;
+            if (n > 0 && !benchMakeWorkload(familyName, n, options.seed, &workload)) {
+                fprintf(stderr, "Skipping %s with %d vertices: the generator rejected its parameters\n", familyName, n);
+            } else if (n > 0) {
+                for (int s = 0; s < numSolvers; s++) {
+                    if (solvers[s].maxVertices == 0 || workload.graph->numVertices <= solvers[s].maxVertices) {
+                        benchRun(program, &solvers[s], &workload, &options);
+                    }
+                }
+                freeGraph(workload.graph);
+            }
+            size += strcspn(size, ",");
+            if (*size == ',') size++;
+        }
+        family += familyLength;
+        if (*family == ',') family++;
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,333 @@
+// Exact vertex cover for bipartite graphs.
+// A BFS 2-coloring detects bipartiteness in O(V + E). On a bipartite graph
+// Hopcroft-Karp finds a maximum matching in O(E sqrt(V)) and Konig's theorem
+// turns it into a minimum vertex cover of the same size: with Z the vertices
+// reachable from free left vertices by alternating paths, the cover is
+// (left \ Z) + (right & Z).
+// The same matching on the bipartite double cover of any graph solves the LP
+// relaxation of vertex cover, see vertexCoverLP().
+
+#ifndef BIPARTITE_H
+#define BIPARTITE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "graph.h"
+#include "graphCSR.h"
+
+// 2-color every component by BFS. Returns a side (0 or 1) per vertex, or NULL
+// if some edge joins two vertices of the same color (an odd cycle or self loop).
+static inline char* bipartiteColoring(const CSRGraph* adj) {
+    int n = adj->numVertices;
+    char* side = (char*)malloc(n + 1);
+    int* queue = (int*)malloc((n + 1) * sizeof(int));
+    if (side == NULL || queue == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    memset(side, -1, n + 1);
+    for (int root = 0; root < n; root++) {
+        if (side[root] >= 0) continue;
+        side[root] = 0;
+        int head = 0, tail = 0;
+        queue[tail++] = root;
+        while (head < tail) {
+            int v = queue[head++];
+            for (int64_t i = adj->offsets[v]; i < adj->offsets[v + 1]; i++) {
+                int u = adj->neighbors[i];
+                if (side[u] < 0) {
+                    side[u] = 1 - side[v];
+                    queue[tail++] = u;
+                } else if (side[u] == side[v]) {
+                    free(queue);
+                    free(side);
+                    return NULL;
+                }
+            }
+        }
+    }
+    free(queue);
+    return side;
+}
+
+// Hopcroft-Karp from the side 0 vertices. match[v] is v's partner or -1.
+// Returns the matching size.
+static inline int hopcroftKarp(const CSRGraph* adj, const char* side, int* match) {
+    int n = adj->numVertices;
+    int* dist = (int*)malloc((n + 1) * sizeof(int));
+    int* queue = (int*)malloc((n + 1) * sizeof(int));
+    int64_t* cursor = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    int* stack = (int*)malloc((n + 1) * sizeof(int));
+    if (dist == NULL || queue == NULL || cursor == NULL || stack == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        match[v] = -1;
+    }
+
+    int size = 0;
+    while (true) {
+        // BFS layers from every free left vertex, alternating through matched edges
+        int head = 0, tail = 0;
+        bool found = false;
+        for (int v = 0; v < n; v++) {
+            dist[v] = -1;
+            if (side[v] == 0 && match[v] < 0) {
+                dist[v] = 0;
+                queue[tail++] = v;
+            }
+        }
+        while (head < tail) {
+            int v = queue[head++];
+            for (int64_t i = adj->offsets[v]; i < adj->offsets[v + 1]; i++) {
+                int w = match[adj->neighbors[i]];
+                if (w < 0) {
+                    found = true;  // a free right vertex ends a shortest augmenting path
+                } else if (dist[w] < 0) {
+                    dist[w] = dist[v] + 1;
+                    queue[tail++] = w;
+                }
+            }
+        }
+        if (!found) break;
+
+        // vertex-disjoint shortest augmenting paths by iterative DFS along the layers
+        for (int v = 0; v < n; v++) {
+            cursor[v] = adj->offsets[v];
+        }
+        for (int root = 0; root < n; root++) {
+            if (side[root] != 0 || match[root] >= 0 || dist[root] != 0) continue;
+            int depth = 0;
+            stack[depth++] = root;
+            while (depth > 0) {
+                int v = stack[depth - 1];
+                if (cursor[v] == adj->offsets[v + 1]) {
+                    dist[v] = -1;  // dead end for the rest of this phase
+                    depth--;
+                    continue;
+                }
+                int u = adj->neighbors[cursor[v]++];
+                int w = match[u];
+                if (w < 0) {
+                    // augment along the stack: each left vertex takes the right vertex its cursor came from
+                    for (int k = depth - 1; k >= 0; k--) {
+                        int left = stack[k];
+                        int right = k == depth - 1 ? u : adj->neighbors[cursor[left] - 1];
+                        match[left] = right;
+                        match[right] = left;
+                    }
+                    size++;
+                    // the path's left vertices may not be reused in this phase
+                    for (int k = 0; k < depth; k++) {
+                        dist[stack[k]] = -1;
+                    }
+                    depth = 0;
+                } else if (dist[w] == dist[v] + 1) {
+                    stack[depth++] = w;
+                }
+            }
+        }
+    }
+
+    free(dist);
+    free(queue);
+    free(cursor);
+    free(stack);
+    return size;
+}
+
+// Konig: mark what the free left vertices reach by alternating paths, then
+// cover (left \ reached) + (right & reached)
+static inline void konigCover(const CSRGraph* adj, const char* side, const int* match, bool* cover) {
+    int n = adj->numVertices;
+    bool* reached = (bool*)calloc(n + 1, sizeof(bool));
+    int* queue = (int*)malloc((n + 1) * sizeof(int));
+    if (reached == NULL || queue == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int head = 0, tail = 0;
+    for (int v = 0; v < n; v++) {
+        if (side[v] == 0 && match[v] < 0) {
+            reached[v] = true;
+            queue[tail++] = v;
+        }
+    }
+    while (head < tail) {
+        int v = queue[head++];
+        for (int64_t i = adj->offsets[v]; i < adj->offsets[v + 1]; i++) {
+            int u = adj->neighbors[i];
+            if (reached[u]) continue;
+            reached[u] = true;
+            // u is a right vertex and matched, otherwise the matching was not maximum
+            if (match[u] >= 0 && !reached[match[u]]) {
+                reached[match[u]] = true;
+                queue[tail++] = match[u];
+            }
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        cover[v] = side[v] == 0 ? !reached[v] : reached[v];
+    }
+    free(reached);
+    free(queue);
+}
+
+// Minimum vertex cover of a bipartite graph given as a CSR, NULL if the graph
+// is not bipartite. Works on a mapped snapshot as well as on a built CSR.
+static inline bool* bipartiteCSRCover(const CSRGraph* adj) {
+    int n = adj->numVertices;
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
+    char* side = bipartiteColoring(adj);
+    if (side == NULL) {
+        INSTR_PHASE_END(PHASE_SOLVE);
+        return NULL;
+    }
+
+    int* match = (int*)malloc((n + 1) * sizeof(int));
+    bool* cover = (bool*)calloc(n + 1, sizeof(bool));
+    if (match == NULL || cover == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    hopcroftKarp(adj, side, match);
+    konigCover(adj, side, match, cover);
+
+    free(match);
+    free(side);
+    INSTR_PHASE_END(PHASE_SOLVE);
+    return cover;
+}
+
+// Minimum vertex cover of a bipartite graph, NULL if the graph is not bipartite.
+// The returned array has graph->numVertices entries.
+static inline bool* bipartiteVertexCover(Graph* graph) {
+    CSRGraph* adj = buildNeighborCSR(graph);
+    bool* cover = bipartiteCSRCover(adj);
+    freeCSR(adj);
+    return cover;
+}
+
+// LP relaxation of vertex cover (Nemhauser-Trotter). Some optimum of the LP is
+// half-integral and comes from the bipartite double cover, which has vertices
+// v and n + v for every v and edges (u, n + v) and (v, n + u) for every edge uv:
+// with C a minimum cover of the double cover, x_v = |C & {v, n + v}| / 2.
+// Finding C is a unit capacity max-flow, which Hopcroft-Karp solves the way
+// Dinic would. Fills twiceX[v] with 2 x_v (0, 1 or 2) and returns 2 * the LP
+// value. Vertices at 1 can be taken and vertices at 0 dropped without losing
+// optimality, the rest is a kernel of at most 2 OPT vertices.
+// endpoints holds 2 ints per edge, like the input of kernelize().
+static inline int64_t vertexCoverLP(int n, const int* endpoints, int64_t numEdges, char* twiceX) {
+    CSRGraph* adj = (CSRGraph*)malloc(sizeof(CSRGraph));
+    int64_t* offsets = (int64_t*)calloc(2 * (int64_t)n + 2, sizeof(int64_t));
+    int* neighbors = (int*)malloc((4 * numEdges + 1) * sizeof(int));
+    char* side = (char*)calloc(2 * (size_t)n + 1, 1);
+    int* match = (int*)malloc((2 * (size_t)n + 1) * sizeof(int));
+    bool* cover = (bool*)malloc(2 * (size_t)n + 1);
+    if (adj == NULL || offsets == NULL || neighbors == NULL || side == NULL || match == NULL || cover == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int64_t i = 0; i < numEdges; i++) {
+        offsets[endpoints[2 * i] + 2]++;
+        offsets[endpoints[2 * i + 1] + 2]++;
+        offsets[n + endpoints[2 * i] + 2]++;
+        offsets[n + endpoints[2 * i + 1] + 2]++;
+    }
+    for (int v = 0; v < 2 * n; v++) {
+        offsets[v + 2] += offsets[v + 1];
+    }
+    for (int64_t i = 0; i < numEdges; i++) {
+        int u = endpoints[2 * i];
+        int v = endpoints[2 * i + 1];
+        neighbors[offsets[u + 1]++] = n + v;
+        neighbors[offsets[n + v + 1]++] = u;
+        neighbors[offsets[v + 1]++] = n + u;
+        neighbors[offsets[n + u + 1]++] = v;
+    }
+    adj->numVertices = 2 * n;
+    adj->numEdges = 2 * numEdges;
+    adj->offsets = offsets;
+    adj->neighbors = neighbors;
+    adj->edgeIds = NULL;
+    for (int v = n; v < 2 * n; v++) {
+        side[v] = 1;
+    }
+
+    int64_t value = hopcroftKarp(adj, side, match);
+    konigCover(adj, side, match, cover);
+    for (int v = 0; v < n; v++) {
+        twiceX[v] = (char)(cover[v] + cover[n + v]);
+    }
+
+    free(side);
+    free(match);
+    free(cover);
+    freeCSR(adj);
+    return value;
+}
+
+// LP rounding: the vertices with x_v >= 1/2 cover every edge with at most
+// twice the LP value, so at most 2 OPT. Vertices at 1/2 whose neighbors are
+// all in the cover are then dropped again, lowest degree first, which keeps
+// the bound and usually gets close to the optimum. lowerBound (if not NULL)
+// gets ceil(LP), a lower bound on any vertex cover.
+static inline bool* lpVertexCover(Graph* graph, int* lowerBound) {
+    int n = graph->numVertices;
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
+    char* twiceX = (char*)malloc(n + 1);
+    bool* cover = (bool*)calloc(n + 1, sizeof(bool));
+    int* order = (int*)malloc((n + 1) * sizeof(int));
+    int* start = (int*)calloc(n + 2, sizeof(int));
+    if (twiceX == NULL || cover == NULL || order == NULL || start == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int64_t value = vertexCoverLP(n, (const int*)graph->edges, graph->numEdges, twiceX);
+    for (int v = 0; v < n; v++) {
+        cover[v] = twiceX[v] > 0;
+    }
+    if (lowerBound != NULL) {
+        *lowerBound = (int)((value + 1) / 2);
+    }
+
+    // counting sort of the half vertices by degree (capped at n)
+    CSRGraph* adj = buildNeighborCSR(graph);
+    int halves = 0;
+    for (int v = 0; v < n; v++) {
+        if (twiceX[v] != 1) continue;
+        int64_t degree = csrDegree(adj, v);
+        start[(degree < n ? degree : n) + 1]++;
+        halves++;
+    }
+    for (int d = 0; d < n; d++) {
+        start[d + 1] += start[d];
+    }
+    for (int v = 0; v < n; v++) {
+        if (twiceX[v] != 1) continue;
+        int64_t degree = csrDegree(adj, v);
+        order[start[degree < n ? degree : n]++] = v;
+    }
+    for (int k = 0; k < halves; k++) {
+        int v = order[k];
+        bool redundant = true;
+        for (int64_t i = adj->offsets[v]; i < adj->offsets[v + 1] && redundant; i++) {
+            redundant = cover[adj->neighbors[i]] && adj->neighbors[i] != v;
+        }
+        if (redundant) cover[v] = false;
+    }
+
+    freeCSR(adj);
+    free(twiceX);
+    free(order);
+    free(start);
+    INSTR_PHASE_END(PHASE_SOLVE);
+    return cover;
+}
+
+#endif
@@ -1,369 +1,1605 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <stdbool.h>
-#include <string.h>
-#include <time.h>
-
-#define MAX_VERTICES 100
-#define MAX_EDGES 1000
-
-// Structure to represent an edge
-typedef struct {
-    int u, v;
-} Edge;
-
-// Structure to represent a graph
-typedef struct {
-    int numVertices;
-    int numEdges;
-    Edge edges[MAX_EDGES];
-} Graph;
-
-// Function to create a graph
-Graph* createGraph(int numVertices) {
-    Graph* graph = (Graph*)malloc(sizeof(Graph));
-    graph->numVertices = numVertices;
-    graph->numEdges = 0;
-    return graph;
-}
-
-// Function to add an edge to the graph
-void addEdge(Graph* graph, int u, int v) {
-    graph->edges[graph->numEdges].u = u;
-    graph->edges[graph->numEdges].v = v;
-    graph->numEdges++;
-}
-
-// Function to verify if a subset of vertices forms a valid vertex cover
-bool verifyVertexCover(bool* cover, Graph* graph) {
-    // Check that at least one vertex from each edge appears in the cover
-    for (int i = 0; i < graph->numEdges; i++) {
-        Edge edge = graph->edges[i];
-        if (!cover[edge.u] && !cover[edge.v]) {
-            return false; // This edge is not covered
-        }
-    }
-    return true; // All edges are covered
-}
-
-// Function to generate all subsets of size k using backtracking
-void generateSubsets(int* vertices, int n, bool* currentSubset, bool* bestSubset, 
-                      int k, int start, Graph* graph, bool* found, int* minSize) {
-    // If we've selected k vertices, check if they form a valid cover
-    if (k == 0) {
-        if (verifyVertexCover(currentSubset, graph)) {
-            // Count the number of vertices in the current subset
-            int size = 0;
-            for (int i = 0; i < n; i++) {
-                if (currentSubset[i]) size++;
-            }
-            
-            // Update the best cover if this is smaller
-            if (!*found || size < *minSize) {
-                *minSize = size;
-                *found = true;
-                memcpy(bestSubset, currentSubset, n * sizeof(bool));
-            }
-        }
-        return;
-    }
-    
-    // If we have no more vertices to consider, return
-    if (start >= n) {
-        return;
-    }
-    
-    // Include the current vertex in the subset
-    currentSubset[start] = true;
-    generateSubsets(vertices, n, currentSubset, bestSubset, k - 1, start + 1, graph, found, minSize);
-    
-    // Exclude the current vertex from the subset
-    currentSubset[start] = false;
-    generateSubsets(vertices, n, currentSubset, bestSubset, k, start + 1, graph, found, minSize);
-}
-
-// Function to find the minimum vertex cover using brute force
-void vertexCoverBrute(Graph* graph) {
-    int n = graph->numVertices;
-    int vertices[MAX_VERTICES];
-    bool currentSubset[MAX_VERTICES] = {false};
-    bool bestSubset[MAX_VERTICES] = {false};
-    bool found = false;
-    int minSize = n + 1; // Initialize to an impossible value
-    
-    // Initialize the vertices array
-    for (int i = 0; i < n; i++) {
-        vertices[i] = i;
-    }
-    
-    // Try all possible subset sizes from 1 to n
-    for (int k = 1; k <= n && !found; k++) {
-        generateSubsets(vertices, n, currentSubset, bestSubset, k, 0, graph, &found, &minSize);
-        if (found) break; // We found a valid cover, no need to check larger sizes
-    }
-    
-    // Print the minimum vertex cover
-    if (found) {
-        printf("Minimum Vertex Cover Size: %d\n", minSize);
-        printf("Vertices in Minimum Cover: ");
-        for (int i = 0; i < n; i++) {
-            if (bestSubset[i]) {
-                printf("%d ", i);
-            }
-        }
-        printf("\n");
-    } else {
-        printf("No valid vertex cover found.\n");
-    }
-}
-
-// Free the memory allocated for the graph
-void freeGraph(Graph* graph) {
-    free(graph);
-}
-
-// Function to test graph351
-void testGraph351() {
-    // Create a graph with 7 vertices (A through G, mapped as 0-6)
-    Graph* graph = createGraph(7);
-    
-    // Add edges for graph351
-    addEdge(graph, 0, 1); // A-B
-    addEdge(graph, 1, 2); // B-C
-    addEdge(graph, 2, 3); // C-D
-    addEdge(graph, 2, 4); // C-E
-    addEdge(graph, 3, 4); // D-E
-    addEdge(graph, 3, 5); // D-F
-    addEdge(graph, 3, 6); // D-G
-    addEdge(graph, 4, 5); // E-F
-    
-    printf("Running brute force algorithm for minimum vertex cover on graph351...\n");
-    vertexCoverBrute(graph);
-    
-    freeGraph(graph);
-}
-
-// Function to test graphConnected (complete graph with 7 vertices)
-void testGraphConnected() {
-    // Create a graph with 7 vertices (A through G, mapped as 0-6)
-    Graph* graph = createGraph(7);
-    
-    // Add edges for graphConnected (complete graph)
-    for (int i = 0; i < 7; i++) {
-        for (int j = i + 1; j < 7; j++) {
-            addEdge(graph, i, j);
-        }
-    }
-    
-    printf("Running brute force algorithm for minimum vertex cover on graphConnected...\n");
-    vertexCoverBrute(graph);
-    
-    freeGraph(graph);
-}
-
-// Function to test graphBipartite
-void testGraphBipartite() {
-    // Create a graph with 10 vertices (A through J, mapped as 0-9)
-    Graph* graph = createGraph(10);
-    
-    // Add edges for graphBipartite
-    addEdge(graph, 0, 5); // A-F
-    addEdge(graph, 0, 6); // A-G
-    addEdge(graph, 1, 5); // B-F
-    addEdge(graph, 2, 7); // C-H
-    addEdge(graph, 2, 6); // C-G
-    addEdge(graph, 3, 7); // D-H
-    addEdge(graph, 3, 9); // D-J
-    addEdge(graph, 4, 8); // E-I
-    addEdge(graph, 4, 9); // E-J
-    
-    printf("Running brute force algorithm for minimum vertex cover on graphBipartite...\n");
-    vertexCoverBrute(graph);
-    
-    freeGraph(graph);
-}
-
-// Function to test graphBig
-void testGraphBig() {
-    // Create a graph with 21 vertices (A through U, mapped as 0-20)
-    Graph* graph = createGraph(21);
-    
-    // Map letters to indices: A=0, B=1, C=2, D=3, E=4, F=5, G=6, H=7, I=8, J=9,
-    // K=10, L=11, M=12, N=13, O=14, P=15, Q=16, R=17, S=18, T=19, U=20
-    
-    // Add edges for graphBig
-    // A's edges
-    addEdge(graph, 0, 1);  // A-B
-    addEdge(graph, 0, 4);  // A-E
-    addEdge(graph, 0, 3);  // A-D
-    
-    // B's edges
-    addEdge(graph, 1, 0);  // B-A
-    addEdge(graph, 1, 4);  // B-E
-    addEdge(graph, 1, 5);  // B-F
-    addEdge(graph, 1, 2);  // B-C
-    
-    // C's edges
-    addEdge(graph, 2, 1);  // C-B
-    addEdge(graph, 2, 5);  // C-F
-    
-    // D's edges
-    addEdge(graph, 3, 0);  // D-A
-    addEdge(graph, 3, 4);  // D-E
-    addEdge(graph, 3, 7);  // D-H
-    addEdge(graph, 3, 6);  // D-G
-    
-    // E's edges
-    addEdge(graph, 4, 3);  // E-D
-    addEdge(graph, 4, 0);  // E-A
-    addEdge(graph, 4, 1);  // E-B
-    addEdge(graph, 4, 5);  // E-F
-    addEdge(graph, 4, 8);  // E-I
-    addEdge(graph, 4, 7);  // E-H
-    
-    // F's edges
-    addEdge(graph, 5, 4);  // F-E
-    addEdge(graph, 5, 1);  // F-B
-    addEdge(graph, 5, 2);  // F-C
-    addEdge(graph, 5, 8);  // F-I
-    
-    // G's edges
-    addEdge(graph, 6, 3);  // G-D
-    addEdge(graph, 6, 7);  // G-H
-    addEdge(graph, 6, 10); // G-K
-    addEdge(graph, 6, 9);  // G-J
-    
-    // H's edges
-    addEdge(graph, 7, 6);  // H-G
-    addEdge(graph, 7, 3);  // H-D
-    addEdge(graph, 7, 4);  // H-E
-    addEdge(graph, 7, 8);  // H-I
-    addEdge(graph, 7, 11); // H-L
-    addEdge(graph, 7, 10); // H-K
-    
-    // I's edges
-    addEdge(graph, 8, 7);  // I-H
-    addEdge(graph, 8, 4);  // I-E
-    addEdge(graph, 8, 5);  // I-F
-    addEdge(graph, 8, 11); // I-L
-    
-    // J's edges
-    addEdge(graph, 9, 6);  // J-G
-    addEdge(graph, 9, 10); // J-K
-    addEdge(graph, 9, 13); // J-N
-    addEdge(graph, 9, 12); // J-M
-    
-    // K's edges
-    addEdge(graph, 10, 9);  // K-J
-    addEdge(graph, 10, 6);  // K-G
-    addEdge(graph, 10, 7);  // K-H
-    addEdge(graph, 10, 11); // K-L
-    addEdge(graph, 10, 14); // K-O
-    addEdge(graph, 10, 13); // K-N
-    
-    // L's edges
-    addEdge(graph, 11, 10); // L-K
-    addEdge(graph, 11, 7);  // L-H
-    addEdge(graph, 11, 8);  // L-I
-    addEdge(graph, 11, 14); // L-O
-    
-    // M's edges
-    addEdge(graph, 12, 9);  // M-J
-    addEdge(graph, 12, 13); // M-N
-    addEdge(graph, 12, 16); // M-Q
-    addEdge(graph, 12, 15); // M-P
-    
-    // N's edges
-    addEdge(graph, 13, 12); // N-M
-    addEdge(graph, 13, 9);  // N-J
-    addEdge(graph, 13, 10); // N-K
-    addEdge(graph, 13, 14); // N-O
-    addEdge(graph, 13, 17); // N-R
-    addEdge(graph, 13, 16); // N-Q
-    
-    // O's edges
-    addEdge(graph, 14, 13); // O-N
-    addEdge(graph, 14, 10); // O-K
-    addEdge(graph, 14, 11); // O-L
-    addEdge(graph, 14, 17); // O-R
-    
-    // P's edges
-    addEdge(graph, 15, 12); // P-M
-    addEdge(graph, 15, 16); // P-Q
-    addEdge(graph, 15, 19); // P-T
-    addEdge(graph, 15, 18); // P-S
-    
-    // Q's edges
-    addEdge(graph, 16, 15); // Q-P
-    addEdge(graph, 16, 12); // Q-M
-    addEdge(graph, 16, 13); // Q-N
-    addEdge(graph, 16, 17); // Q-R
-    addEdge(graph, 16, 20); // Q-U
-    addEdge(graph, 16, 19); // Q-T
-    
-    // R's edges
-    addEdge(graph, 17, 16); // R-Q
-    addEdge(graph, 17, 13); // R-N
-    addEdge(graph, 17, 14); // R-O
-    addEdge(graph, 17, 20); // R-U
-    
-    // S's edges
-    addEdge(graph, 18, 15); // S-P
-    addEdge(graph, 18, 19); // S-T
-    
-    // T's edges
-    addEdge(graph, 19, 18); // T-S
-    addEdge(graph, 19, 15); // T-P
-    addEdge(graph, 19, 16); // T-Q
-    addEdge(graph, 19, 20); // T-U
-    
-    // U's edges
-    addEdge(graph, 20, 19); // U-T
-    addEdge(graph, 20, 16); // U-Q
-    addEdge(graph, 20, 17); // U-R
-    
-    printf("Running brute force algorithm for minimum vertex cover on graphBig...\n");
-    vertexCoverBrute(graph);
-    
-    freeGraph(graph);
-}
-
-// Function to time a graph test
-double timeTest(void (*testFunction)()) {
-    clock_t start, end;
-    double cpuTimeUsed;
-    
-    start = clock();
-    testFunction();
-    end = clock();
-    
-    cpuTimeUsed = ((double) (end - start)) / CLOCKS_PER_SEC;
-    return cpuTimeUsed;
-}
-
-int main() {
-    double timeUsed;
-    
-    printf("Testing graph351...\n");
-    timeUsed = timeTest(testGraph351);
-    printf("Time taken for graph351: %.6f seconds\n\n", timeUsed);
-    
-    printf("Testing graphConnected...\n");
-    timeUsed = timeTest(testGraphConnected);
-    printf("Time taken for graphConnected: %.6f seconds\n\n", timeUsed);
-    
-    printf("Testing graphBipartite...\n");
-    timeUsed = timeTest(testGraphBipartite);
-    printf("Time taken for graphBipartite: %.6f seconds\n\n", timeUsed);
-    
-    printf("Testing graphBig\n");
-    timeUsed = timeTest(testGraphBig);
-    printf("Time taken for graphBig: %.6f seconds\n", timeUsed);
-    
-    return 0;
-}
-
-
-// Reference
-// https://github.com/sedgwickc/VertexCoverSearch/blob/main/VertexCover.py
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "graph.h"
+#include "kernelization.h"
+#include "graphLoader.h"
+#include "graphSnapshot.h"
+#include "benchmark.h"
+#include "bipartite.h"
+#include "localRatio.h"
+#include "components.h"
+#include "resultCache.h"
+#include "maxClique.h"
+
+// Function to verify if a subset of vertices forms a valid vertex cover
+bool verifyVertexCover(bool* cover, Graph* graph) {
+    INSTR_PHASE_BEGIN(PHASE_VERIFY);
+    INSTR_COUNT(INSTR_LEAVES, 1);
+    // Check that at least one vertex from each edge appears in the cover
+    for (int64_t i = 0; i < graph->numEdges; i++) {
+        Edge edge = graph->edges[i];
+        if (!cover[edge.u] && !cover[edge.v]) {
+            INSTR_COUNT(INSTR_EDGES_SCANNED, i + 1);
+            INSTR_PHASE_END(PHASE_VERIFY);
+            return false; // This edge is not covered
+        }
+    }
+    INSTR_COUNT(INSTR_EDGES_SCANNED, graph->numEdges);
+    INSTR_PHASE_END(PHASE_VERIFY);
+    return true; // All edges are covered
+}
+
+// Best cover found so far, shared by all search threads.
+// bestSize is read on every pruning test without locking,
+// the lock only guards replacing bestCover together with bestSize.
+typedef struct {
+    atomic_int bestSize;
+    bool* bestCover;
+    pthread_mutex_t lock;
+} SharedIncumbent;
+
+// Search state for the branch and bound solver.
+// Vertices are removed from the residual graph either by going into the cover
+// or by being left out of it, every removal is pushed on a trail so a branch
+// can be undone in reverse order by restoring the neighbors' degrees.
+typedef struct {
+    int n;
+    int* offsets;   // deduplicated adjacency in CSR form
+    int* neighbors;
+    int* degree;    // residual degree of every vertex
+    bool* removed;
+    bool* inCover;
+    int* trail;
+    int trailSize;
+    int remainingEdges;
+    int coverSize;
+    bool* bestCover;
+    int bestSize;
+    int* matchStamp; // scratch for the matching lower bound
+    int stamp;
+    SharedIncumbent* shared; // NULL for the sequential search
+} SearchState;
+
+// Build deduplicated adjacency lists, self loops are left out and handled by the caller
+static void buildAdjacency(int n, Edge* edges, int64_t numEdges, SearchState* state) {
+    // the exact search indexes adjacency with int, kernels are far below this
+    if (numEdges > INT32_MAX / 2) {
+        fprintf(stderr, "Graph too large for exact search: %lld edges\n", (long long)numEdges);
+        exit(EXIT_FAILURE);
+    }
+    int* offsets = (int*)calloc(n + 1, sizeof(int));
+    int* neighbors = (int*)malloc((2 * numEdges + 1) * sizeof(int));
+    int* cursor = (int*)malloc((n + 1) * sizeof(int));
+    int* lastSeen = (int*)malloc((n + 1) * sizeof(int));
+    if (!offsets || !neighbors || !cursor || !lastSeen) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int64_t i = 0; i < numEdges; i++) {
+        Edge edge = edges[i];
+        if (edge.u == edge.v) continue;
+        offsets[edge.u + 1]++;
+        offsets[edge.v + 1]++;
+    }
+    for (int v = 0; v < n; v++) {
+        offsets[v + 1] += offsets[v];
+        cursor[v] = offsets[v];
+    }
+    for (int64_t i = 0; i < numEdges; i++) {
+        Edge edge = edges[i];
+        if (edge.u == edge.v) continue;
+        neighbors[cursor[edge.u]++] = edge.v;
+        neighbors[cursor[edge.v]++] = edge.u;
+    }
+
+    // compact every slice, dropping repeated neighbors
+    int write = 0;
+    for (int v = 0; v < n; v++) {
+        lastSeen[v] = -1;
+    }
+    for (int v = 0; v < n; v++) {
+        int begin = offsets[v];
+        int end = offsets[v + 1];
+        offsets[v] = write;
+        for (int i = begin; i < end; i++) {
+            int w = neighbors[i];
+            if (lastSeen[w] != v) {
+                lastSeen[w] = v;
+                neighbors[write++] = w;
+            }
+        }
+    }
+    offsets[n] = write;
+
+    state->offsets = offsets;
+    state->neighbors = neighbors;
+    free(cursor);
+    free(lastSeen);
+}
+
+// Remove a vertex from the residual graph, either into the cover or out of it
+static void removeVertex(SearchState* state, int v, bool takeIntoCover) {
+    state->removed[v] = true;
+    state->inCover[v] = takeIntoCover;
+    if (takeIntoCover) state->coverSize++;
+    for (int i = state->offsets[v]; i < state->offsets[v + 1]; i++) {
+        int w = state->neighbors[i];
+        if (!state->removed[w]) {
+            state->degree[w]--;
+            state->remainingEdges--;
+        }
+    }
+    INSTR_COUNT(INSTR_EDGES_SCANNED, state->offsets[v + 1] - state->offsets[v]);
+    state->trail[state->trailSize++] = v;
+}
+
+// Undo removals until the trail is back at mark
+static void undoTo(SearchState* state, int mark) {
+    while (state->trailSize > mark) {
+        int v = state->trail[--state->trailSize];
+        for (int i = state->offsets[v]; i < state->offsets[v + 1]; i++) {
+            int w = state->neighbors[i];
+            if (!state->removed[w]) {
+                state->degree[w]++;
+                state->remainingEdges++;
+            }
+        }
+        if (state->inCover[v]) state->coverSize--;
+        state->removed[v] = false;
+        state->inCover[v] = false;
+    }
+}
+
+// Take every remaining neighbor of v and leave v out of the cover
+static void takeNeighborhood(SearchState* state, int v) {
+    for (int i = state->offsets[v]; i < state->offsets[v + 1]; i++) {
+        int w = state->neighbors[i];
+        if (!state->removed[w]) {
+            removeVertex(state, w, true);
+        }
+    }
+    removeVertex(state, v, false);
+}
+
+// Degree 0 vertices never need to be in the cover and for a degree 1 vertex
+// taking its only neighbor is always at least as good, apply both until nothing changes
+static void foldLowDegree(SearchState* state) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int v = 0; v < state->n; v++) {
+            if (state->removed[v]) continue;
+            if (state->degree[v] == 0) {
+                removeVertex(state, v, false);
+                changed = true;
+                INSTR_COUNT(INSTR_REDUCTIONS, 1);
+            } else if (state->degree[v] == 1) {
+                takeNeighborhood(state, v);
+                changed = true;
+                INSTR_COUNT(INSTR_REDUCTIONS, 1);
+            }
+        }
+    }
+}
+
+// Lower bound on the cover still needed: every edge of a maximal matching
+// needs its own cover vertex, and no vertex covers more than maxDegree edges
+static int lowerBound(SearchState* state, int maxDegree) {
+    int matching = 0;
+    state->stamp++;
+    for (int v = 0; v < state->n; v++) {
+        if (state->removed[v] || state->matchStamp[v] == state->stamp) continue;
+        for (int i = state->offsets[v]; i < state->offsets[v + 1]; i++) {
+            int w = state->neighbors[i];
+            if (!state->removed[w] && state->matchStamp[w] != state->stamp) {
+                state->matchStamp[v] = state->stamp;
+                state->matchStamp[w] = state->stamp;
+                matching++;
+                break;
+            }
+        }
+    }
+    int degreeBound = (state->remainingEdges + maxDegree - 1) / maxDegree;
+    return matching > degreeBound ? matching : degreeBound;
+}
+
+static int incumbentSize(SearchState* state) {
+    if (state->shared) {
+        return atomic_load_explicit(&state->shared->bestSize, memory_order_relaxed);
+    }
+    return state->bestSize;
+}
+
+static void recordIncumbent(SearchState* state) {
+    if (state->shared) {
+        SharedIncumbent* shared = state->shared;
+        if (state->coverSize >= atomic_load(&shared->bestSize)) return;
+        pthread_mutex_lock(&shared->lock);
+        if (state->coverSize < atomic_load(&shared->bestSize)) {
+            memcpy(shared->bestCover, state->inCover, state->n * sizeof(bool));
+            atomic_store(&shared->bestSize, state->coverSize);
+        }
+        pthread_mutex_unlock(&shared->lock);
+        return;
+    }
+    if (state->coverSize < state->bestSize) {
+        state->bestSize = state->coverSize;
+        memcpy(state->bestCover, state->inCover, state->n * sizeof(bool));
+    }
+}
+
+// Branch on a max degree vertex v: either v is in the cover or all of N(v) is
+static void branchAndBound(SearchState* state) {
+    int mark = state->trailSize;
+    INSTR_COUNT(INSTR_NODES, 1);
+    foldLowDegree(state);
+
+    if (state->remainingEdges == 0) {
+        INSTR_COUNT(INSTR_LEAVES, 1);
+        recordIncumbent(state);
+        undoTo(state, mark);
+        return;
+    }
+
+    int branchVertex = -1;
+    int maxDegree = 0;
+    for (int v = 0; v < state->n; v++) {
+        if (!state->removed[v] && state->degree[v] > maxDegree) {
+            maxDegree = state->degree[v];
+            branchVertex = v;
+        }
+    }
+
+    if (state->coverSize + lowerBound(state, maxDegree) >= incumbentSize(state)) {
+        INSTR_COUNT(INSTR_PRUNES, 1);
+        undoTo(state, mark);
+        return;
+    }
+
+    int branchMark = state->trailSize;
+    removeVertex(state, branchVertex, true);
+    branchAndBound(state);
+    undoTo(state, branchMark);
+
+    if (state->coverSize + maxDegree < incumbentSize(state)) {
+        takeNeighborhood(state, branchVertex);
+        branchAndBound(state);
+        undoTo(state, branchMark);
+    } else {
+        INSTR_COUNT(INSTR_PRUNES, 1);
+    }
+
+    undoTo(state, mark);
+}
+
+// Seed the incumbent with a max degree greedy cover
+static void greedyIncumbent(SearchState* state) {
+    int mark = state->trailSize;
+    while (state->remainingEdges > 0) {
+        int best = -1;
+        for (int v = 0; v < state->n; v++) {
+            if (!state->removed[v] && (best == -1 || state->degree[v] > state->degree[best])) {
+                best = v;
+            }
+        }
+        removeVertex(state, best, true);
+    }
+    recordIncumbent(state);
+    undoTo(state, mark);
+}
+
+// Allocate the per search arrays, the adjacency itself is shared and not owned
+static void initSearchState(SearchState* state, int n, int* offsets, int* neighbors) {
+    state->n = n;
+    state->offsets = offsets;
+    state->neighbors = neighbors;
+    state->degree = (int*)malloc((n + 1) * sizeof(int));
+    state->removed = (bool*)calloc(n + 1, sizeof(bool));
+    state->inCover = (bool*)calloc(n + 1, sizeof(bool));
+    state->trail = (int*)malloc((n + 1) * sizeof(int));
+    state->matchStamp = (int*)calloc(n + 1, sizeof(int));
+    if (!state->degree || !state->removed || !state->inCover || !state->trail || !state->matchStamp) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    state->bestCover = NULL;
+    state->trailSize = 0;
+    state->remainingEdges = 0;
+    state->coverSize = 0;
+    state->bestSize = n + 1; // Initialize to an impossible value
+    state->stamp = 0;
+    state->shared = NULL;
+
+    for (int v = 0; v < n; v++) {
+        state->degree[v] = offsets[v + 1] - offsets[v];
+        state->remainingEdges += state->degree[v];
+    }
+    state->remainingEdges /= 2;
+}
+
+static void freeSearchState(SearchState* state) {
+    free(state->degree);
+    free(state->removed);
+    free(state->inCover);
+    free(state->trail);
+    free(state->matchStamp);
+}
+
+// a vertex with a self loop has to be in every cover
+static void takeSelfLoops(SearchState* state, Edge* edges, int64_t numEdges) {
+    for (int64_t i = 0; i < numEdges; i++) {
+        int v = edges[i].u;
+        if (v == edges[i].v && !state->removed[v]) {
+            removeVertex(state, v, true);
+        }
+    }
+}
+
+// Minimum vertex cover of an edge list by branch and bound,
+// fills cover (n entries) and returns its size
+int branchAndBoundCover(int n, Edge* edges, int64_t numEdges, bool* cover) {
+    SearchState state;
+    buildAdjacency(n, edges, numEdges, &state);
+    initSearchState(&state, n, state.offsets, state.neighbors);
+    state.bestCover = cover;
+
+    takeSelfLoops(&state, edges, numEdges);
+    greedyIncumbent(&state);
+    branchAndBound(&state);
+
+    free(state.offsets);
+    free(state.neighbors);
+    freeSearchState(&state);
+    return state.bestSize;
+}
+
+// --- weighted search ---
+// The reduction rules, the matching bound and the bitmask engine all count
+// vertices, so vertex costs get their own branch and bound on the same
+// residual graph: the local ratio payments over the remaining edges bound the
+// cost still needed from below.
+
+typedef struct {
+    const int64_t* weights;
+    int64_t* residual;   // scratch for the local ratio bound
+    int64_t cost;        // cost of the vertices taken so far
+    int64_t bestCost;
+} WeightedSearch;
+
+static void weightedRemove(SearchState* state, WeightedSearch* search, int v, bool takeIntoCover) {
+    removeVertex(state, v, takeIntoCover);
+    if (takeIntoCover) search->cost += search->weights[v];
+}
+
+static void weightedUndoTo(SearchState* state, WeightedSearch* search, int mark) {
+    for (int i = mark; i < state->trailSize; i++) {
+        int v = state->trail[i];
+        if (state->inCover[v]) search->cost -= search->weights[v];
+    }
+    undoTo(state, mark);
+}
+
+// Isolated vertices are dropped and a degree 1 vertex that costs at least as
+// much as its neighbor gives way to it, until nothing changes
+static void weightedFoldLowDegree(SearchState* state, WeightedSearch* search) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int v = 0; v < state->n; v++) {
+            if (state->removed[v]) continue;
+            if (state->degree[v] == 0) {
+                weightedRemove(state, search, v, false);
+                changed = true;
+                INSTR_COUNT(INSTR_REDUCTIONS, 1);
+            } else if (state->degree[v] == 1) {
+                int u = -1;
+                for (int i = state->offsets[v]; i < state->offsets[v + 1] && u < 0; i++) {
+                    if (!state->removed[state->neighbors[i]]) u = state->neighbors[i];
+                }
+                if (search->weights[v] >= search->weights[u]) {
+                    weightedRemove(state, search, u, true);
+                    weightedRemove(state, search, v, false);
+                    changed = true;
+                    INSTR_COUNT(INSTR_REDUCTIONS, 1);
+                }
+            }
+        }
+    }
+}
+
+// local ratio payments over the remaining edges
+static int64_t weightedLowerBound(SearchState* state, WeightedSearch* search) {
+    int64_t paid = 0;
+    for (int v = 0; v < state->n; v++) {
+        search->residual[v] = search->weights[v];
+    }
+    for (int v = 0; v < state->n; v++) {
+        if (state->removed[v]) continue;
+        for (int i = state->offsets[v]; i < state->offsets[v + 1] && search->residual[v] > 0; i++) {
+            int w = state->neighbors[i];
+            if (w < v || state->removed[w]) continue;
+            int64_t d = search->residual[v] < search->residual[w] ? search->residual[v] : search->residual[w];
+            search->residual[v] -= d;
+            search->residual[w] -= d;
+            paid += d;
+        }
+    }
+    return paid;
+}
+
+// Branch on a max degree vertex v: either v is in the cover or all of N(v) is
+static void weightedBranchAndBound(SearchState* state, WeightedSearch* search) {
+    int mark = state->trailSize;
+    INSTR_COUNT(INSTR_NODES, 1);
+    weightedFoldLowDegree(state, search);
+
+    if (state->remainingEdges == 0) {
+        INSTR_COUNT(INSTR_LEAVES, 1);
+        if (search->cost < search->bestCost) {
+            search->bestCost = search->cost;
+            memcpy(state->bestCover, state->inCover, state->n * sizeof(bool));
+        }
+        weightedUndoTo(state, search, mark);
+        return;
+    }
+    if (search->cost + weightedLowerBound(state, search) >= search->bestCost) {
+        INSTR_COUNT(INSTR_PRUNES, 1);
+        weightedUndoTo(state, search, mark);
+        return;
+    }
+
+    int branchVertex = -1;
+    for (int v = 0; v < state->n; v++) {
+        if (!state->removed[v] && (branchVertex == -1 || state->degree[v] > state->degree[branchVertex])) {
+            branchVertex = v;
+        }
+    }
+    int64_t neighborhoodCost = 0;
+    for (int i = state->offsets[branchVertex]; i < state->offsets[branchVertex + 1]; i++) {
+        if (!state->removed[state->neighbors[i]]) neighborhoodCost += search->weights[state->neighbors[i]];
+    }
+
+    int branchMark = state->trailSize;
+    weightedRemove(state, search, branchVertex, true);
+    weightedBranchAndBound(state, search);
+    weightedUndoTo(state, search, branchMark);
+
+    if (search->cost + neighborhoodCost < search->bestCost) {
+        for (int i = state->offsets[branchVertex]; i < state->offsets[branchVertex + 1]; i++) {
+            if (!state->removed[state->neighbors[i]]) weightedRemove(state, search, state->neighbors[i], true);
+        }
+        weightedRemove(state, search, branchVertex, false);
+        weightedBranchAndBound(state, search);
+        weightedUndoTo(state, search, branchMark);
+    } else {
+        INSTR_COUNT(INSTR_PRUNES, 1);
+    }
+
+    weightedUndoTo(state, search, mark);
+}
+
+// Minimum cost vertex cover of a graph with vertex costs (negative costs are
+// not supported), fills cover (numVertices entries) and returns its cost
+int64_t weightedBranchAndBoundCover(Graph* graph, bool* cover) {
+    int n = graph->numVertices;
+    SearchState state;
+    buildAdjacency(n, graph->edges, graph->numEdges, &state);
+    initSearchState(&state, n, state.offsets, state.neighbors);
+    state.bestCover = cover;
+
+    WeightedSearch search;
+    search.weights = graph->weights;
+    search.residual = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    if (!search.residual) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    search.cost = 0;
+
+    // the local ratio cover is the incumbent to beat
+    bool* incumbent = localRatioVertexCover(graph, NULL);
+    memcpy(cover, incumbent, n * sizeof(bool));
+    search.bestCost = coverWeight(graph, incumbent);
+    free(incumbent);
+
+    for (int64_t i = 0; i < graph->numEdges; i++) {
+        int v = graph->edges[i].u;
+        if (v == graph->edges[i].v && !state.removed[v]) {
+            weightedRemove(&state, &search, v, true);
+        }
+    }
+    weightedBranchAndBound(&state, &search);
+
+    free(search.residual);
+    free(state.offsets);
+    free(state.neighbors);
+    freeSearchState(&state);
+    return search.bestCost;
+}
+
+// A subtree of the search: the removals that lead to it, replayed in order
+typedef struct {
+    int* vertices;
+    bool* takes;
+    int length;
+} SearchTask;
+
+// Work stealing deque of tasks. The owner pops from the bottom,
+// idle threads steal from the top, where the larger subtrees sit.
+typedef struct {
+    SearchTask* tasks;
+    int top;
+    int bottom;
+    int capacity;
+    pthread_mutex_t lock;
+} TaskDeque;
+
+typedef struct {
+    SearchTask* tasks;
+    int count;
+    int capacity;
+} TaskList;
+
+static void pushTask(TaskList* list, SearchState* state) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? 2 * list->capacity : 64;
+        list->tasks = (SearchTask*)realloc(list->tasks, list->capacity * sizeof(SearchTask));
+        if (!list->tasks) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    SearchTask* task = &list->tasks[list->count++];
+    task->length = state->trailSize;
+    task->vertices = (int*)malloc((state->trailSize + 1) * sizeof(int));
+    task->takes = (bool*)malloc((state->trailSize + 1) * sizeof(bool));
+    if (!task->vertices || !task->takes) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < state->trailSize; i++) {
+        task->vertices[i] = state->trail[i];
+        task->takes[i] = state->inCover[state->trail[i]];
+    }
+}
+
+// Same branching as branchAndBound, but the subtrees at the given depth
+// are recorded as tasks instead of being searched
+static void collectTasks(SearchState* state, int depth, TaskList* list) {
+    int mark = state->trailSize;
+    foldLowDegree(state);
+
+    if (state->remainingEdges == 0) {
+        recordIncumbent(state);
+        undoTo(state, mark);
+        return;
+    }
+    if (depth == 0) {
+        pushTask(list, state);
+        undoTo(state, mark);
+        return;
+    }
+
+    int branchVertex = -1;
+    int maxDegree = 0;
+    for (int v = 0; v < state->n; v++) {
+        if (!state->removed[v] && state->degree[v] > maxDegree) {
+            maxDegree = state->degree[v];
+            branchVertex = v;
+        }
+    }
+
+    if (state->coverSize + lowerBound(state, maxDegree) >= incumbentSize(state)) {
+        INSTR_COUNT(INSTR_PRUNES, 1);
+        undoTo(state, mark);
+        return;
+    }
+
+    int branchMark = state->trailSize;
+    removeVertex(state, branchVertex, true);
+    collectTasks(state, depth - 1, list);
+    undoTo(state, branchMark);
+
+    if (state->coverSize + maxDegree < incumbentSize(state)) {
+        takeNeighborhood(state, branchVertex);
+        collectTasks(state, depth - 1, list);
+        undoTo(state, branchMark);
+    }
+
+    undoTo(state, mark);
+}
+
+typedef struct {
+    int id;
+    int numWorkers;
+    TaskDeque* deques;
+    SharedIncumbent* shared;
+    int n;
+    int* offsets;
+    int* neighbors;
+} SearchWorker;
+
+static bool popBottom(TaskDeque* deque, SearchTask* task) {
+    bool found = false;
+    pthread_mutex_lock(&deque->lock);
+    if (deque->bottom > deque->top) {
+        *task = deque->tasks[--deque->bottom];
+        found = true;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+static bool stealTop(TaskDeque* deque, SearchTask* task) {
+    bool found = false;
+    pthread_mutex_lock(&deque->lock);
+    if (deque->bottom > deque->top) {
+        *task = deque->tasks[deque->top++];
+        found = true;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+// Run tasks from the own deque, then steal from the others.
+// All tasks exist before the workers start, so once every deque
+// is empty there is nothing left to do.
+static void* searchWorker(void* arg) {
+    SearchWorker* worker = (SearchWorker*)arg;
+    SearchState state;
+    initSearchState(&state, worker->n, worker->offsets, worker->neighbors);
+    state.shared = worker->shared;
+
+    SearchTask task;
+    while (true) {
+        bool found = popBottom(&worker->deques[worker->id], &task);
+        for (int i = 1; i < worker->numWorkers && !found; i++) {
+            found = stealTop(&worker->deques[(worker->id + i) % worker->numWorkers], &task);
+        }
+        if (!found) break;
+
+        for (int i = 0; i < task.length; i++) {
+            removeVertex(&state, task.vertices[i], task.takes[i]);
+        }
+        branchAndBound(&state);
+        undoTo(&state, 0);
+    }
+
+    freeSearchState(&state);
+    return NULL;
+}
+
+// Parallel branch and bound. The search tree is split into tasks at splitDepth,
+// the tasks are dealt round robin to one deque per thread and the threads
+// prune against the shared incumbent. Fills cover and returns its size.
+int parallelBranchAndBoundCover(int n, Edge* edges, int64_t numEdges, bool* cover, int numThreads, int splitDepth) {
+    SharedIncumbent shared;
+    atomic_init(&shared.bestSize, n + 1);
+    shared.bestCover = cover;
+    pthread_mutex_init(&shared.lock, NULL);
+
+    SearchState master;
+    buildAdjacency(n, edges, numEdges, &master);
+    initSearchState(&master, n, master.offsets, master.neighbors);
+    master.shared = &shared;
+
+    takeSelfLoops(&master, edges, numEdges);
+    greedyIncumbent(&master);
+
+    TaskList list = {NULL, 0, 0};
+    collectTasks(&master, splitDepth, &list);
+
+    TaskDeque* deques = (TaskDeque*)malloc(numThreads * sizeof(TaskDeque));
+    SearchWorker* workers = (SearchWorker*)malloc(numThreads * sizeof(SearchWorker));
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    if (!deques || !workers || !threads) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        deques[t].capacity = list.count / numThreads + 1;
+        deques[t].tasks = (SearchTask*)malloc(deques[t].capacity * sizeof(SearchTask));
+        if (!deques[t].tasks) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        deques[t].top = 0;
+        deques[t].bottom = 0;
+        pthread_mutex_init(&deques[t].lock, NULL);
+    }
+    for (int i = 0; i < list.count; i++) {
+        TaskDeque* deque = &deques[i % numThreads];
+        deque->tasks[deque->bottom++] = list.tasks[i];
+    }
+
+    for (int t = 0; t < numThreads; t++) {
+        workers[t].id = t;
+        workers[t].numWorkers = numThreads;
+        workers[t].deques = deques;
+        workers[t].shared = &shared;
+        workers[t].n = n;
+        workers[t].offsets = master.offsets;
+        workers[t].neighbors = master.neighbors;
+        pthread_create(&threads[t], NULL, searchWorker, &workers[t]);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    for (int t = 0; t < numThreads; t++) {
+        free(deques[t].tasks);
+        pthread_mutex_destroy(&deques[t].lock);
+    }
+    for (int i = 0; i < list.count; i++) {
+        free(list.tasks[i].vertices);
+        free(list.tasks[i].takes);
+    }
+    free(list.tasks);
+    free(deques);
+    free(workers);
+    free(threads);
+    free(master.offsets);
+    free(master.neighbors);
+    freeSearchState(&master);
+    pthread_mutex_destroy(&shared.lock);
+    return atomic_load(&shared.bestSize);
+}
+
+// Bitmask engine for small kernels.
+// Subsets and neighborhoods are machine words, S is a cover exactly when
+// N(v) is a subset of S for every v outside S. The k-subsets are walked in
+// combination order (Gosper's hack) and the number of uncovered edges is kept
+// up to date from the few bits that change between consecutive subsets,
+// so a leaf costs a handful of popcounts instead of a pass over the edges.
+// The edge list must not contain self loops, kernels never do.
+
+// Give up on enumeration past this many subsets and use branch and bound instead.
+// Enumeration runs at roughly 10^8 subsets per second but does not prune,
+// so past a millisecond or so of work the branch and bound search wins.
+#define BITMASK_SUBSET_BUDGET 1048576.0
+
+// sum of C(n, k) for k in [low, high], as a double so it cannot overflow
+static double subsetCount(int n, int low, int high) {
+    double total = 0.0;
+    double binomial = 1.0;
+    for (int k = 0; k <= high; k++) {
+        if (k >= low) total += binomial;
+        binomial = binomial * (n - k) / (k + 1);
+    }
+    return total;
+}
+
+static int bitmaskCover64(int n, uint64_t* adj, int minSize, int maxSize, uint64_t* result) {
+    uint64_t all = n == 64 ? ~0ULL : (1ULL << n) - 1;
+
+    for (int k = minSize; k <= maxSize; k++) {
+        uint64_t subset = k == 64 ? ~0ULL : (1ULL << k) - 1;
+        uint64_t last = subset << (n - k);
+
+        long uncovered = 0;
+        for (uint64_t rest = all & ~subset; rest; rest &= rest - 1) {
+            uncovered += __builtin_popcountll(adj[__builtin_ctzll(rest)] & ~subset);
+        }
+        uncovered /= 2;
+
+        while (true) {
+            INSTR_COUNT(INSTR_LEAVES, 1);
+            if (uncovered == 0) {
+                *result = subset;
+                return k;
+            }
+            if (subset == last || k == 0) break;
+
+            // next k-subset in combination order
+            uint64_t lowest = subset & -subset;
+            uint64_t ripple = subset + lowest;
+            uint64_t next = ripple | (((ripple ^ subset) >> 2) >> __builtin_ctzll(lowest));
+
+            uint64_t leaving = subset & ~next;
+            uint64_t entering = next & ~subset;
+            for (; leaving; leaving &= leaving - 1) {
+                int v = __builtin_ctzll(leaving);
+                subset &= ~(1ULL << v);
+                uncovered += __builtin_popcountll(adj[v] & ~subset);
+            }
+            for (; entering; entering &= entering - 1) {
+                int v = __builtin_ctzll(entering);
+                uncovered -= __builtin_popcountll(adj[v] & ~subset);
+                subset |= 1ULL << v;
+            }
+        }
+    }
+    return -1;
+}
+
+#ifdef __SIZEOF_INT128__
+typedef unsigned __int128 uint128;
+
+static int popcount128(uint128 x) {
+    return __builtin_popcountll((uint64_t)x) + __builtin_popcountll((uint64_t)(x >> 64));
+}
+
+static int ctz128(uint128 x) {
+    uint64_t low = (uint64_t)x;
+    return low ? __builtin_ctzll(low) : 64 + __builtin_ctzll((uint64_t)(x >> 64));
+}
+
+static int bitmaskCover128(int n, uint128* adj, int minSize, int maxSize, uint128* result) {
+    uint128 one = 1;
+    uint128 all = n == 128 ? ~(uint128)0 : (one << n) - 1;
+
+    for (int k = minSize; k <= maxSize; k++) {
+        uint128 subset = k == 128 ? ~(uint128)0 : (one << k) - 1;
+        uint128 last = subset << (n - k);
+
+        long uncovered = 0;
+        for (uint128 rest = all & ~subset; rest; rest &= rest - 1) {
+            uncovered += popcount128(adj[ctz128(rest)] & ~subset);
+        }
+        uncovered /= 2;
+
+        while (true) {
+            INSTR_COUNT(INSTR_LEAVES, 1);
+            if (uncovered == 0) {
+                *result = subset;
+                return k;
+            }
+            if (subset == last || k == 0) break;
+
+            uint128 lowest = subset & -subset;
+            uint128 ripple = subset + lowest;
+            uint128 next = ripple | (((ripple ^ subset) >> 2) >> ctz128(lowest));
+
+            uint128 leaving = subset & ~next;
+            uint128 entering = next & ~subset;
+            for (; leaving; leaving &= leaving - 1) {
+                int v = ctz128(leaving);
+                subset &= ~(one << v);
+                uncovered += popcount128(adj[v] & ~subset);
+            }
+            for (; entering; entering &= entering - 1) {
+                int v = ctz128(entering);
+                uncovered -= popcount128(adj[v] & ~subset);
+                subset |= one << v;
+            }
+        }
+    }
+    return -1;
+}
+#endif
+
+// Matching lower bound and max degree greedy upper bound, computed on the same adjacency.
+// The greedy cover is written to cover.
+static void coverBounds(int n, Edge* edges, int64_t numEdges, int* lower, int* upper, bool* cover) {
+    SearchState state;
+    buildAdjacency(n, edges, numEdges, &state);
+    initSearchState(&state, n, state.offsets, state.neighbors);
+    state.bestCover = cover;
+
+    int maxDegree = 1;
+    for (int v = 0; v < n; v++) {
+        if (state.degree[v] > maxDegree) maxDegree = state.degree[v];
+    }
+    *lower = lowerBound(&state, maxDegree);
+    greedyIncumbent(&state);
+    *upper = state.bestSize;
+
+    free(state.offsets);
+    free(state.neighbors);
+    freeSearchState(&state);
+}
+
+// Exact cover with the bitmask engine. Returns -1 without solving when n > 128
+// or when more than BITMASK_SUBSET_BUDGET subsets could have to be checked.
+int bitmaskVertexCover(int n, Edge* edges, int64_t numEdges, bool* cover) {
+    if (n > 128) return -1;
+
+    int lower, upper;
+    coverBounds(n, edges, numEdges, &lower, &upper, cover);
+    // the greedy cover already has size upper, only smaller ones need checking
+    if (lower >= upper) return upper;
+    if (subsetCount(n, lower, upper - 1) > BITMASK_SUBSET_BUDGET) return -1;
+
+    int size = -1;
+    if (n <= 64) {
+        uint64_t adj[64] = {0};
+        for (int64_t i = 0; i < numEdges; i++) {
+            adj[edges[i].u] |= 1ULL << edges[i].v;
+            adj[edges[i].v] |= 1ULL << edges[i].u;
+        }
+        uint64_t subset = 0;
+        size = bitmaskCover64(n, adj, lower, upper - 1, &subset);
+        if (size < 0) return upper;
+        for (int v = 0; v < n; v++) {
+            cover[v] = (subset >> v) & 1;
+        }
+    } else {
+#ifdef __SIZEOF_INT128__
+        uint128 adj[128] = {0};
+        uint128 one = 1;
+        for (int64_t i = 0; i < numEdges; i++) {
+            adj[edges[i].u] |= one << edges[i].v;
+            adj[edges[i].v] |= one << edges[i].u;
+        }
+        uint128 subset = 0;
+        size = bitmaskCover128(n, adj, lower, upper - 1, &subset);
+        if (size < 0) return upper;
+        for (int v = 0; v < n; v++) {
+            cover[v] = (subset >> v) & 1;
+        }
+#endif
+    }
+    return size;
+}
+
+// Kernels at least this dense go to the maximum clique search on the
+// complement. On random kernels it is ahead of branch and bound from about
+// 0.05 and by orders of magnitude from 0.3 on. The bit matrix needs n^2 / 8
+// bytes, hence the vertex limit.
+#define DENSE_KERNEL_DENSITY 0.1
+#define DENSE_KERNEL_MAX_VERTICES 8192
+
+static bool isDenseKernel(const Kernel* kernel) {
+    double n = kernel->numVertices;
+    return n > 1 && n <= DENSE_KERNEL_MAX_VERTICES && 2.0 * kernel->numEdges >= DENSE_KERNEL_DENSITY * n * (n - 1);
+}
+
+// Exact search settings, set from the command line
+int searchThreads = 1;   // 1 runs the sequential search
+int splitDepth = -1;     // depth of the task split, -1 picks one from the thread count
+
+// Exact minimum cover of a kernel into kernelCover: maximum clique on the
+// complement when dense, bitmask enumeration when small, branch and bound (on
+// threads threads when more than one) otherwise
+static void solveKernel(const Kernel* kernel, bool printKernel, int threads, bool* kernelCover) {
+    int kernelSize;
+    if (isDenseKernel(kernel)) {
+        if (printKernel) {
+            printf("Dense kernel: maximum clique of the complement\n");
+        }
+        kernelSize = maxCliqueVertexCover(kernel->numVertices, (Edge*)kernel->endpoints, kernel->numEdges, kernelCover);
+    } else {
+        kernelSize = bitmaskVertexCover(kernel->numVertices, (Edge*)kernel->endpoints, kernel->numEdges, kernelCover);
+    }
+    if (kernelSize < 0 && threads > 1) {
+        // a few tasks per thread so stealing can even out uneven subtrees
+        int depth = splitDepth;
+        if (depth < 0) {
+            depth = 3;
+            while ((1 << (depth - 3)) < threads) depth++;
+        }
+        parallelBranchAndBoundCover(kernel->numVertices, (Edge*)kernel->endpoints, kernel->numEdges,
+                                    kernelCover, threads, depth);
+    } else if (kernelSize < 0) {
+        branchAndBoundCover(kernel->numVertices, (Edge*)kernel->endpoints, kernel->numEdges, kernelCover);
+    }
+}
+
+// Exact minimum cover of one component: graphs with vertex costs go to the
+// weighted search, bipartite graphs are solved by Konig's theorem, anything
+// else is kernelized. The greedy cover of the kernel is the incumbent. When a
+// kernel vertex has more neighbors than incumbent - 1, or the kernel more
+// edges than its square, a second pass with that budget applies the Buss
+// rule: either it proves the greedy cover optimal, or the bounded kernel is
+// solved with solveKernel and lifted through both kernels. Other kernels are
+// solved with solveKernel directly.
+// Returns a new cover array of graph->numVertices entries.
+bool* exactComponentCover(Graph* graph, bool printKernel, int threads) {
+    if (graph->weights != NULL) {
+        bool* cover = (bool*)calloc(graph->numVertices + 1, sizeof(bool));
+        if (!cover) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        if (printKernel) {
+            printf("Weighted graph: branch and bound on vertex costs\n");
+        }
+        weightedBranchAndBoundCover(graph, cover);
+        return cover;
+    }
+
+    bool* bipartiteCover = bipartiteVertexCover(graph);
+    if (bipartiteCover != NULL) {
+        if (printKernel) {
+            printf("Bipartite graph: cover from a maximum matching (Konig)\n");
+        }
+        return bipartiteCover;
+    }
+
+    Kernel* kernel = kernelize(graph->numVertices, (const int*)graph->edges, graph->numEdges, -1);
+    if (printKernel) {
+        printf("Kernel: %d vertices, %lld edges, %d cover vertices fixed by reductions, LP lower bound %d\n",
+               kernel->numVertices, (long long)kernel->numEdges, kernel->coverOffset, kernel->lowerBound);
+    }
+
+    bool* kernelCover = (bool*)calloc(kernel->numVertices + 1, sizeof(bool));
+    if (!kernelCover) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int lower = 0, upper = 0;
+    if (kernel->numVertices > 0) {
+        coverBounds(kernel->numVertices, (Edge*)kernel->endpoints, kernel->numEdges, &lower, &upper, kernelCover);
+    }
+    int budget = upper - 1;
+    bool bussApplies = kernel->numEdges > (int64_t)budget * budget;
+    if (lower < upper && !bussApplies) {
+        int* degree = (int*)calloc(kernel->numVertices + 1, sizeof(int));
+        if (!degree) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        for (int64_t i = 0; i < 2 * kernel->numEdges; i++) {
+            if (++degree[kernel->endpoints[i]] > budget) bussApplies = true;
+        }
+        free(degree);
+    }
+    if (lower < upper && !bussApplies) {
+        solveKernel(kernel, printKernel, threads, kernelCover);
+    } else if (lower < upper) {
+        Kernel* bounded = kernelize(kernel->numVertices, kernel->endpoints, kernel->numEdges, budget);
+        if (printKernel) {
+            printf("Budget %d: %d vertices taken by the high degree rule, %d vertices and %lld edges left%s\n",
+                   budget, bounded->highDegreeTaken, bounded->numVertices, (long long)bounded->numEdges,
+                   bounded->infeasible ? ", the greedy cover is optimal" : "");
+        }
+        if (!bounded->infeasible) {
+            bool* boundedCover = (bool*)calloc(bounded->numVertices + 1, sizeof(bool));
+            if (!boundedCover) {
+                perror("Memory allocation failed");
+                exit(EXIT_FAILURE);
+            }
+            solveKernel(bounded, printKernel, threads, boundedCover);
+            bool* lifted = liftKernelCover(bounded, boundedCover);
+            int size = 0;
+            for (int v = 0; v < kernel->numVertices; v++) {
+                if (lifted[v]) size++;
+            }
+            // without a cover of size <= budget the bounded kernel may lift to a worse one
+            if (size < upper) {
+                memcpy(kernelCover, lifted, kernel->numVertices * sizeof(bool));
+            }
+            free(lifted);
+            free(boundedCover);
+        }
+        freeKernel(bounded);
+    }
+    bool* cover = liftKernelCover(kernel, kernelCover);
+
+    free(kernelCover);
+    freeKernel(kernel);
+    return cover;
+}
+
+// Results of earlier solves, NULL while benchmarking so every repetition searches
+ResultCache* resultCache = NULL;
+
+// Larger graphs skip the cache: sorting their edges for the key costs about
+// as much as the near linear solvers that handle them.
+#define RESULT_CACHE_MAX_EDGES (1 << 20)
+
+// exactComponentCover behind the result cache
+bool* cachedComponentCover(Graph* graph, bool printKernel, int threads) {
+    if (resultCache == NULL || graph->numEdges > RESULT_CACHE_MAX_EDGES) {
+        return exactComponentCover(graph, printKernel, threads);
+    }
+    CacheKey* key = cacheKey(graph, true);
+    bool* cover = cacheLookup(resultCache, key, "exact", NULL);
+    if (cover != NULL) {
+        if (printKernel) {
+            printf("Cache hit: %d vertices, %lld edges solved before\n", graph->numVertices, (long long)key->numEdges);
+        }
+    } else {
+        cover = exactComponentCover(graph, printKernel, threads);
+        cacheStore(resultCache, key, "exact", cover);
+    }
+    freeCacheKey(key);
+    return cover;
+}
+
+bool* sequentialComponentCover(Graph* component) {
+    return cachedComponentCover(component, false, 1);
+}
+
+bool* parallelComponentCover(Graph* component) {
+    return cachedComponentCover(component, false, searchThreads);
+}
+
+// Exact minimum cover, solved one connected component at a time so the search
+// is exponential in the largest component only. Components run concurrently
+// on searchThreads threads, except that one holding most of the vertices is
+// solved first with the parallel search to itself.
+bool* exactVertexCover(Graph* graph, bool printKernel) {
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
+    ComponentSplit* split = splitComponents(graph);
+    if (split->numComponents <= 1) {
+        freeComponentSplit(split);
+        bool* cover = cachedComponentCover(graph, printKernel, searchThreads);
+        INSTR_PHASE_END(PHASE_SOLVE);
+        return cover;
+    }
+
+    bool* cover = (bool*)calloc(graph->numVertices + 1, sizeof(bool));
+    if (!cover) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int largest = componentVertices(split, 0);
+    if (printKernel) {
+        printf("Components: %d, the largest has %d vertices\n", split->numComponents, largest);
+    }
+    int first = 0;
+    if (searchThreads > 1 && 2 * largest > split->vertexOffsets[split->numComponents]) {
+        solveComponent(graph, split, 0, parallelComponentCover, cover);
+        first = 1;
+    }
+    solveComponents(graph, split, first, sequentialComponentCover, searchThreads, cover);
+    freeComponentSplit(split);
+    INSTR_PHASE_END(PHASE_SOLVE);
+    return cover;
+}
+
+bool* benchExactCover(Graph* graph) {
+    return exactVertexCover(graph, false);
+}
+
+void vertexCoverBrute(Graph* graph) {
+    int n = graph->numVertices;
+    bool* bestSubset = exactVertexCover(graph, true);
+    if (!verifyVertexCover(bestSubset, graph)) {
+        fprintf(stderr, "Exact search returned an invalid cover\n");
+    }
+
+    int minSize = 0;
+    for (int i = 0; i < n; i++) {
+        if (bestSubset[i]) minSize++;
+    }
+
+    // Print the minimum vertex cover
+    printf("Minimum Vertex Cover Size: %d\n", minSize);
+    if (graph->weights) {
+        printf("Minimum Vertex Cover Cost: %lld\n", (long long)coverWeight(graph, bestSubset));
+    }
+    printf("Vertices in Minimum Cover: ");
+    for (int i = 0; i < n; i++) {
+        if (bestSubset[i]) {
+            printf("%d ", i);
+        }
+    }
+    printf("\n");
+
+    free(bestSubset);
+}
+
+// Function to test graph351
+void testGraph351() {
+    // Create a graph with 7 vertices (A through G, mapped as 0-6)
+    Graph* graph = createGraph(7, 8);
+    
+    // Add edges for graph351
+    addEdge(graph, 0, 1); // A-B
+    addEdge(graph, 1, 2); // B-C
+    addEdge(graph, 2, 3); // C-D
+    addEdge(graph, 2, 4); // C-E
+    addEdge(graph, 3, 4); // D-E
+    addEdge(graph, 3, 5); // D-F
+    addEdge(graph, 3, 6); // D-G
+    addEdge(graph, 4, 5); // E-F
+    
+    printf("Running brute force algorithm for minimum vertex cover on graph351...\n");
+    vertexCoverBrute(graph);
+    
+    freeGraph(graph);
+}
+
+// Function to test graphConnected (complete graph with 7 vertices)
+void testGraphConnected() {
+    // Create a graph with 7 vertices (A through G, mapped as 0-6)
+    Graph* graph = createGraph(7, 21);
+    
+    // Add edges for graphConnected (complete graph)
+    for (int i = 0; i < 7; i++) {
+        for (int j = i + 1; j < 7; j++) {
+            addEdge(graph, i, j);
+        }
+    }
+    
+    printf("Running brute force algorithm for minimum vertex cover on graphConnected...\n");
+    vertexCoverBrute(graph);
+    
+    freeGraph(graph);
+}
+
+// Function to test graphBipartite
+void testGraphBipartite() {
+    // Create a graph with 10 vertices (A through J, mapped as 0-9)
+    Graph* graph = createGraph(10, 9);
+    
+    // Add edges for graphBipartite
+    addEdge(graph, 0, 5); // A-F
+    addEdge(graph, 0, 6); // A-G
+    addEdge(graph, 1, 5); // B-F
+    addEdge(graph, 2, 7); // C-H
+    addEdge(graph, 2, 6); // C-G
+    addEdge(graph, 3, 7); // D-H
+    addEdge(graph, 3, 9); // D-J
+    addEdge(graph, 4, 8); // E-I
+    addEdge(graph, 4, 9); // E-J
+    
+    printf("Running brute force algorithm for minimum vertex cover on graphBipartite...\n");
+    vertexCoverBrute(graph);
+    
+    freeGraph(graph);
+}
+
+// Function to test graphBig
+void testGraphBig() {
+    // Create a graph with 21 vertices (A through U, mapped as 0-20)
+    Graph* graph = createGraph(21, 88);
+    
+    // Map letters to indices: A=0, B=1, C=2, D=3, E=4, F=5, G=6, H=7, I=8, J=9,
+    // K=10, L=11, M=12, N=13, O=14, P=15, Q=16, R=17, S=18, T=19, U=20
+    
+    // Add edges for graphBig
+    // A's edges
+    addEdge(graph, 0, 1);  // A-B
+    addEdge(graph, 0, 4);  // A-E
+    addEdge(graph, 0, 3);  // A-D
+    
+    // B's edges
+    addEdge(graph, 1, 0);  // B-A
+    addEdge(graph, 1, 4);  // B-E
+    addEdge(graph, 1, 5);  // B-F
+    addEdge(graph, 1, 2);  // B-C
+    
+    // C's edges
+    addEdge(graph, 2, 1);  // C-B
+    addEdge(graph, 2, 5);  // C-F
+    
+    // D's edges
+    addEdge(graph, 3, 0);  // D-A
+    addEdge(graph, 3, 4);  // D-E
+    addEdge(graph, 3, 7);  // D-H
+    addEdge(graph, 3, 6);  // D-G
+    
+    // E's edges
+    addEdge(graph, 4, 3);  // E-D
+    addEdge(graph, 4, 0);  // E-A
+    addEdge(graph, 4, 1);  // E-B
+    addEdge(graph, 4, 5);  // E-F
+    addEdge(graph, 4, 8);  // E-I
+    addEdge(graph, 4, 7);  // E-H
+    
+    // F's edges
+    addEdge(graph, 5, 4);  // F-E
+    addEdge(graph, 5, 1);  // F-B
+    addEdge(graph, 5, 2);  // F-C
+    addEdge(graph, 5, 8);  // F-I
+    
+    // G's edges
+    addEdge(graph, 6, 3);  // G-D
+    addEdge(graph, 6, 7);  // G-H
+    addEdge(graph, 6, 10); // G-K
+    addEdge(graph, 6, 9);  // G-J
+    
+    // H's edges
+    addEdge(graph, 7, 6);  // H-G
+    addEdge(graph, 7, 3);  // H-D
+    addEdge(graph, 7, 4);  // H-E
+    addEdge(graph, 7, 8);  // H-I
+    addEdge(graph, 7, 11); // H-L
+    addEdge(graph, 7, 10); // H-K
+    
+    // I's edges
+    addEdge(graph, 8, 7);  // I-H
+    addEdge(graph, 8, 4);  // I-E
+    addEdge(graph, 8, 5);  // I-F
+    addEdge(graph, 8, 11); // I-L
+    
+    // J's edges
+    addEdge(graph, 9, 6);  // J-G
+    addEdge(graph, 9, 10); // J-K
+    addEdge(graph, 9, 13); // J-N
+    addEdge(graph, 9, 12); // J-M
+    
+    // K's edges
+    addEdge(graph, 10, 9);  // K-J
+    addEdge(graph, 10, 6);  // K-G
+    addEdge(graph, 10, 7);  // K-H
+    addEdge(graph, 10, 11); // K-L
+    addEdge(graph, 10, 14); // K-O
+    addEdge(graph, 10, 13); // K-N
+    
+    // L's edges
+    addEdge(graph, 11, 10); // L-K
+    addEdge(graph, 11, 7);  // L-H
+    addEdge(graph, 11, 8);  // L-I
+    addEdge(graph, 11, 14); // L-O
+    
+    // M's edges
+    addEdge(graph, 12, 9);  // M-J
+    addEdge(graph, 12, 13); // M-N
+    addEdge(graph, 12, 16); // M-Q
+    addEdge(graph, 12, 15); // M-P
+    
+    // N's edges
+    addEdge(graph, 13, 12); // N-M
+    addEdge(graph, 13, 9);  // N-J
+    addEdge(graph, 13, 10); // N-K
+    addEdge(graph, 13, 14); // N-O
+    addEdge(graph, 13, 17); // N-R
+    addEdge(graph, 13, 16); // N-Q
+    
+    // O's edges
+    addEdge(graph, 14, 13); // O-N
+    addEdge(graph, 14, 10); // O-K
+    addEdge(graph, 14, 11); // O-L
+    addEdge(graph, 14, 17); // O-R
+    
+    // P's edges
+    addEdge(graph, 15, 12); // P-M
+    addEdge(graph, 15, 16); // P-Q
+    addEdge(graph, 15, 19); // P-T
+    addEdge(graph, 15, 18); // P-S
+    
+    // Q's edges
+    addEdge(graph, 16, 15); // Q-P
+    addEdge(graph, 16, 12); // Q-M
+    addEdge(graph, 16, 13); // Q-N
+    addEdge(graph, 16, 17); // Q-R
+    addEdge(graph, 16, 20); // Q-U
+    addEdge(graph, 16, 19); // Q-T
+    
+    // R's edges
+    addEdge(graph, 17, 16); // R-Q
+    addEdge(graph, 17, 13); // R-N
+    addEdge(graph, 17, 14); // R-O
+    addEdge(graph, 17, 20); // R-U
+    
+    // S's edges
+    addEdge(graph, 18, 15); // S-P
+    addEdge(graph, 18, 19); // S-T
+    
+    // T's edges
+    addEdge(graph, 19, 18); // T-S
+    addEdge(graph, 19, 15); // T-P
+    addEdge(graph, 19, 16); // T-Q
+    addEdge(graph, 19, 20); // T-U
+    
+    // U's edges
+    addEdge(graph, 20, 19); // U-T
+    addEdge(graph, 20, 16); // U-Q
+    addEdge(graph, 20, 17); // U-R
+    
+    printf("Running brute force algorithm for minimum vertex cover on graphBig...\n");
+    vertexCoverBrute(graph);
+    
+    freeGraph(graph);
+}
+
+// graph351 with a cost on every vertex, the same costs as in greedy.c and vertexCoverDP.c
+void testGraphWeighted() {
+    static const int64_t costs[7] = {3, 1, 4, 2, 5, 1, 1};
+    Graph* graph = createGraph(7, 8);
+    addEdge(graph, 0, 1); // A-B
+    addEdge(graph, 1, 2); // B-C
+    addEdge(graph, 2, 3); // C-D
+    addEdge(graph, 2, 4); // C-E
+    addEdge(graph, 3, 4); // D-E
+    addEdge(graph, 3, 5); // D-F
+    addEdge(graph, 3, 6); // D-G
+    addEdge(graph, 4, 5); // E-F
+    for (int v = 0; v < 7; v++) {
+        setVertexWeight(graph, v, costs[v]);
+    }
+
+    printf("Running brute force algorithm for minimum cost vertex cover on graphWeighted...\n");
+    vertexCoverBrute(graph);
+    freeGraph(graph);
+}
+
+// G(200, 0.9): the kernel stays dense and goes to the maximum clique search
+void testGraphDense() {
+    GeneratorSpec spec;
+    defaultGeneratorSpec(&spec, GEN_GNP, 200, 142);
+    spec.p = 0.9;
+    Graph* graph = generateGraph(&spec, 1);
+
+    printf("Running brute force algorithm for minimum vertex cover on graphDense...\n");
+    vertexCoverBrute(graph);
+    freeGraph(graph);
+}
+
+// Wheel of a hub and an 8-cycle, minimum cover 5. With budget 4 or 5 the hub
+// has degree above the budget and the Buss rule takes it, the cycle then needs
+// 4 more vertices, which only fit budget 5. Without a budget the rule is off.
+void testKernelBudget() {
+    int endpoints[32];
+    for (int i = 0; i < 8; i++) {
+        endpoints[4 * i] = 8;
+        endpoints[4 * i + 1] = i;
+        endpoints[4 * i + 2] = i;
+        endpoints[4 * i + 3] = (i + 1) % 8;
+    }
+    static const int budgets[3] = {4, 5, -1};
+    static const int expectTaken[3] = {1, 1, 0};
+    static const bool expectInfeasible[3] = {true, false, false};
+    for (int i = 0; i < 3; i++) {
+        Kernel* kernel = kernelize(9, endpoints, 16, budgets[i]);
+        printf("Budget %d: %d taken by the high degree rule, %s\n", budgets[i], kernel->highDegreeTaken,
+               kernel->infeasible ? "infeasible" : "feasible");
+        if (kernel->highDegreeTaken != expectTaken[i] || kernel->infeasible != expectInfeasible[i]) {
+            fprintf(stderr, "kernelize with budget %d: expected %d taken, %s\n", budgets[i], expectTaken[i],
+                    expectInfeasible[i] ? "infeasible" : "feasible");
+            exit(EXIT_FAILURE);
+        }
+        freeKernel(kernel);
+    }
+}
+
+// two copies of graph351, a 5-cycle and an isolated vertex, solved component by component
+void testGraphComponents() {
+    Graph* graph = createGraph(20, 21);
+    for (int copy = 0; copy < 14; copy += 7) {
+        addEdge(graph, copy + 0, copy + 1); // A-B
+        addEdge(graph, copy + 1, copy + 2); // B-C
+        addEdge(graph, copy + 2, copy + 3); // C-D
+        addEdge(graph, copy + 2, copy + 4); // C-E
+        addEdge(graph, copy + 3, copy + 4); // D-E
+        addEdge(graph, copy + 3, copy + 5); // D-F
+        addEdge(graph, copy + 3, copy + 6); // D-G
+        addEdge(graph, copy + 4, copy + 5); // E-F
+    }
+    for (int v = 14; v < 19; v++) {
+        addEdge(graph, v, v + 1 < 19 ? v + 1 : 14);
+    }
+
+    printf("Running brute force algorithm for minimum vertex cover on graphComponents...\n");
+    vertexCoverBrute(graph);
+    freeGraph(graph);
+}
+
+// graph given on the command line (edge list, DIMACS .col/.clq, METIS .graph or a snapshot)
+const char* graphFile = NULL;
+
+void testGraphFile() {
+    // snapshots are mapped as they are, text files are parsed into a Graph
+    GraphSnapshot* snapshot = NULL;
+    Graph* graph;
+    INSTR_PHASE_BEGIN(PHASE_LOAD);
+    if (isSnapshotFile(graphFile)) {
+        snapshot = openSnapshot(graphFile);
+        graph = snapshot ? &snapshot->graph : NULL;
+    } else {
+        graph = loadGraph(graphFile, FORMAT_AUTO);
+    }
+    INSTR_PHASE_END(PHASE_LOAD);
+    if (graph == NULL) {
+        exit(EXIT_FAILURE);
+    }
+    printf("Loaded %d vertices, %lld edges\n", graph->numVertices, (long long)graph->numEdges);
+    vertexCoverBrute(graph);
+    if (snapshot) {
+        closeSnapshot(snapshot);
+    } else {
+        freeGraph(graph);
+    }
+}
+
+void printCacheStats(void) {
+    if (resultCache == NULL) return;
+    printf("Result cache: %lld hits (%lld from disk), %lld misses\n", (long long)resultCache->hits,
+           (long long)resultCache->diskHits, (long long)resultCache->misses);
+    closeResultCache(resultCache);
+    resultCache = NULL;
+}
+
+// Function to time a graph test
+double timeTest(void (*testFunction)()) {
+    clock_t start, end;
+    double cpuTimeUsed;
+    
+    start = clock();
+    testFunction();
+    end = clock();
+    
+    cpuTimeUsed = ((double) (end - start)) / CLOCKS_PER_SEC;
+    return cpuTimeUsed;
+}
+
+int main(int argc, char* argv[]) {
+    double timeUsed;
+
+    // -t <threads> runs the exact search in parallel (0 = one per core),
+    // -d <depth> sets how deep the search tree is split into tasks,
+    // --cache <file> keeps solved graphs in a file across runs,
+    // --no-cache solves everything from scratch,
+    // --bench runs the benchmark matrix with the options that follow it,
+    // a file argument solves that graph instead of the built-in tests,
+    // --stats <file> dumps the instrumentation counters at exit
+    instrumentStatsOption(&argc, argv, "bruteforce");
+    const char* cacheFile = NULL;
+    bool useCache = true;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bench") == 0) {
+            // exact search is exponential, keep it to the small sizes of the matrix
+            BenchSolver solvers[] = {{"exact", benchExactCover, 100}};
+            return runBenchmarks("bruteforce", solvers, 1, argc - i - 1, argv + i + 1);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            searchThreads = atoi(argv[++i]);
+            if (searchThreads <= 0) searchThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            splitDepth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+            cacheFile = argv[++i];
+        } else if (strcmp(argv[i], "--no-cache") == 0) {
+            useCache = false;
+        } else {
+            graphFile = argv[i];
+        }
+    }
+
+    if (useCache) {
+        resultCache = openResultCache(4096, cacheFile);
+        if (resultCache == NULL) {
+            return 1;
+        }
+    }
+
+    if (graphFile != NULL) {
+        printf("Testing %s...\n", graphFile);
+        timeUsed = timeTest(testGraphFile);
+        printf("Time taken for %s: %.6f seconds\n", graphFile, timeUsed);
+        printCacheStats();
+        return 0;
+    }
+    
+    printf("Testing graph351...\n");
+    timeUsed = timeTest(testGraph351);
+    printf("Time taken for graph351: %.6f seconds\n\n", timeUsed);
+    
+    printf("Testing graphConnected...\n");
+    timeUsed = timeTest(testGraphConnected);
+    printf("Time taken for graphConnected: %.6f seconds\n\n", timeUsed);
+    
+    printf("Testing graphBipartite...\n");
+    timeUsed = timeTest(testGraphBipartite);
+    printf("Time taken for graphBipartite: %.6f seconds\n\n", timeUsed);
+    
+    printf("Testing graphBig\n");
+    timeUsed = timeTest(testGraphBig);
+    printf("Time taken for graphBig: %.6f seconds\n\n", timeUsed);
+
+    printf("Testing graphWeighted...\n");
+    timeUsed = timeTest(testGraphWeighted);
+    printf("Time taken for graphWeighted: %.6f seconds\n\n", timeUsed);
+
+    printf("Testing graphComponents...\n");
+    timeUsed = timeTest(testGraphComponents);
+    printf("Time taken for graphComponents: %.6f seconds\n\n", timeUsed);
+
+    printf("Testing graphDense...\n");
+    timeUsed = timeTest(testGraphDense);
+    printf("Time taken for graphDense: %.6f seconds\n\n", timeUsed);
+
+    printf("Testing kernelBudget...\n");
+    timeUsed = timeTest(testKernelBudget);
+    printf("Time taken for kernelBudget: %.6f seconds\n", timeUsed);
+    printCacheStats();
+    
+    return 0;
+}
+
+
+// Reference
+// https://github.com/sedgwickc/VertexCoverSearch/blob/main/VertexCover.py
 // Asked Claude.ai to convert into C, hope that's okay
\ No newline at end of file
@@ -0,0 +1,254 @@
+// Connected component split. A minimum cover of a graph is the union of
+// minimum covers of its components, so an exponential solver pays for the
+// largest component instead of the whole graph, and independent components
+// can be solved at the same time.
+//
+// Components come from union-find (union by size, path halving) in
+// O(m alpha(n)). Vertices are relabelled 0..k-1 inside their component, and
+// the edges are grouped by component with a counting sort. Components are
+// ordered largest first, which suits a pool that hands them out in order.
+// Vertices without edges belong to no component and never enter a cover.
+
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "graph.h"
+
+typedef struct ComponentSplit {
+    int numComponents;
+    int* vertexOffsets;   // component c owns vertices[vertexOffsets[c] .. vertexOffsets[c + 1])
+    int* vertices;        // original ids, so local vertex i of c is vertices[vertexOffsets[c] + i]
+    int64_t* edgeOffsets; // same for edges
+    Edge* edges;          // endpoints in local ids
+} ComponentSplit;
+
+static inline int componentFind(int* parent, int v) {
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+static inline ComponentSplit* splitComponents(const Graph* graph) {
+    int n = graph->numVertices;
+    int64_t m = graph->numEdges;
+    int* parent = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    int* size = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    int* label = (int*)malloc(((size_t)n + 1) * sizeof(int));   // component of each root
+    int* local = (int*)malloc(((size_t)n + 1) * sizeof(int));   // id inside the component
+    ComponentSplit* split = (ComponentSplit*)calloc(1, sizeof(ComponentSplit));
+    if (!parent || !size || !label || !local || !split) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        parent[v] = v;
+        size[v] = 1;
+        label[v] = -1;
+    }
+    bool* touched = (bool*)calloc((size_t)n + 1, sizeof(bool));
+    if (!touched) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int64_t i = 0; i < m; i++) {
+        int u = graph->edges[i].u;
+        int v = graph->edges[i].v;
+        touched[u] = touched[v] = true;
+        int a = componentFind(parent, u);
+        int b = componentFind(parent, v);
+        if (a == b) continue;
+        if (size[a] < size[b]) {
+            int tmp = a;
+            a = b;
+            b = tmp;
+        }
+        parent[b] = a;
+        size[a] += size[b];
+    }
+
+    // number the roots of non-trivial components, then order them by size
+    int count = 0;
+    for (int v = 0; v < n; v++) {
+        if (touched[v] && parent[v] == v) label[v] = count++;
+    }
+    int* roots = (int*)malloc(((size_t)count + 1) * sizeof(int));
+    int* bucket = (int*)calloc((size_t)n + 2, sizeof(int));
+    if (!roots || !bucket) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    // counting sort on size, largest first
+    for (int v = 0; v < n; v++) {
+        if (label[v] >= 0) bucket[n - size[v]]++;
+    }
+    for (int s = 0, sum = 0; s <= n; s++) {
+        int c = bucket[s];
+        bucket[s] = sum;
+        sum += c;
+    }
+    for (int v = 0; v < n; v++) {
+        if (label[v] >= 0) roots[bucket[n - size[v]]++] = v;
+    }
+    for (int c = 0; c < count; c++) {
+        label[roots[c]] = c;
+    }
+
+    split->numComponents = count;
+    split->vertexOffsets = (int*)calloc((size_t)count + 1, sizeof(int));
+    split->edgeOffsets = (int64_t*)calloc((size_t)count + 1, sizeof(int64_t));
+    split->vertices = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    split->edges = (Edge*)malloc(((size_t)m + 1) * sizeof(Edge));
+    if (!split->vertexOffsets || !split->edgeOffsets || !split->vertices || !split->edges) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int c = 0; c < count; c++) {
+        split->vertexOffsets[c + 1] = split->vertexOffsets[c] + size[roots[c]];
+    }
+
+    // place the vertices, local ids follow the original order
+    int* cursor = bucket;
+    for (int c = 0; c < count; c++) {
+        cursor[c] = split->vertexOffsets[c];
+    }
+    for (int v = 0; v < n; v++) {
+        if (!touched[v]) continue;
+        int c = label[componentFind(parent, v)];
+        local[v] = cursor[c] - split->vertexOffsets[c];
+        split->vertices[cursor[c]++] = v;
+    }
+
+    // group the edges by component
+    for (int64_t i = 0; i < m; i++) {
+        split->edgeOffsets[label[componentFind(parent, graph->edges[i].u)] + 1]++;
+    }
+    for (int c = 0; c < count; c++) {
+        split->edgeOffsets[c + 1] += split->edgeOffsets[c];
+    }
+    int64_t* edgeCursor = (int64_t*)malloc(((size_t)count + 1) * sizeof(int64_t));
+    if (!edgeCursor) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(edgeCursor, split->edgeOffsets, (size_t)count * sizeof(int64_t));
+    for (int64_t i = 0; i < m; i++) {
+        int u = graph->edges[i].u;
+        int v = graph->edges[i].v;
+        int c = label[componentFind(parent, u)];
+        split->edges[edgeCursor[c]++] = (Edge){local[u], local[v]};
+    }
+
+    free(edgeCursor);
+    free(bucket);
+    free(roots);
+    free(touched);
+    free(local);
+    free(label);
+    free(size);
+    free(parent);
+    return split;
+}
+
+static inline void freeComponentSplit(ComponentSplit* split) {
+    free(split->vertexOffsets);
+    free(split->vertices);
+    free(split->edgeOffsets);
+    free(split->edges);
+    free(split);
+}
+
+static inline int componentVertices(const ComponentSplit* split, int c) {
+    return split->vertexOffsets[c + 1] - split->vertexOffsets[c];
+}
+
+// Component c as a Graph of its own, vertex costs included
+static inline Graph* componentGraph(const Graph* graph, const ComponentSplit* split, int c) {
+    int n = componentVertices(split, c);
+    int64_t m = split->edgeOffsets[c + 1] - split->edgeOffsets[c];
+    Graph* component = createGraph(n, m);
+    addEdges(component, split->edges + split->edgeOffsets[c], m);
+    if (graph->weights != NULL) {
+        for (int i = 0; i < n; i++) {
+            setVertexWeight(component, i, graph->weights[split->vertices[split->vertexOffsets[c] + i]]);
+        }
+    }
+    return component;
+}
+
+// --- solving on a pool ---
+
+typedef bool* (*ComponentSolver)(Graph* component);
+
+typedef struct ComponentJob {
+    const Graph* graph;
+    const ComponentSplit* split;
+    ComponentSolver solve;
+    bool* cover;
+    atomic_int next;
+} ComponentJob;
+
+// solve component c and copy its cover into the cover of the whole graph
+static inline void solveComponent(const Graph* graph, const ComponentSplit* split, int c, ComponentSolver solve,
+                                  bool* cover) {
+    Graph* component = componentGraph(graph, split, c);
+    bool* componentCover = solve(component);
+    const int* vertices = split->vertices + split->vertexOffsets[c];
+    for (int i = 0; i < component->numVertices; i++) {
+        if (componentCover[i]) cover[vertices[i]] = true;
+    }
+    free(componentCover);
+    freeGraph(component);
+}
+
+static inline void* componentWorker(void* arg) {
+    ComponentJob* job = (ComponentJob*)arg;
+    while (true) {
+        int c = atomic_fetch_add(&job->next, 1);
+        if (c >= job->split->numComponents) break;
+        solveComponent(job->graph, job->split, c, job->solve, job->cover);
+    }
+    return NULL;
+}
+
+// Solve components first..numComponents-1 on threads workers, largest first,
+// and mark their covers in cover. Components own distinct vertices, so the
+// workers never write the same entry.
+static inline void solveComponents(const Graph* graph, const ComponentSplit* split, int first, ComponentSolver solve,
+                                   int threads, bool* cover) {
+    ComponentJob job;
+    job.graph = graph;
+    job.split = split;
+    job.solve = solve;
+    job.cover = cover;
+    atomic_init(&job.next, first);
+    int remaining = split->numComponents - first;
+    if (threads > remaining) threads = remaining;
+    if (threads <= 1) {
+        componentWorker(&job);
+        return;
+    }
+    pthread_t* workers = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    if (!workers) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&workers[i], NULL, componentWorker, &job);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    free(workers);
+}
+
+#endif
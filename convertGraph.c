@@ -0,0 +1,33 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "graph.h"
+#include "graphLoader.h"
+#include "graphSnapshot.h"
+
+// Convert an edge list, DIMACS or METIS file into a binary snapshot that
+// greedy, greedyV2 and bruteforce can map directly.
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <input graph> <output snapshot>\n", argv[0]);
+        return 1;
+    }
+
+    clock_t start = clock();
+    Graph* graph = loadGraph(argv[1], FORMAT_AUTO);
+    if (graph == NULL) {
+        return 1;
+    }
+    printf("Loaded %d vertices, %lld edges in %.6f seconds\n", graph->numVertices,
+           (long long)graph->numEdges, ((double)(clock() - start)) / CLOCKS_PER_SEC);
+
+    start = clock();
+    bool ok = writeSnapshot(argv[2], graph);
+    freeGraph(graph);
+    if (!ok) {
+        return 1;
+    }
+    printf("Wrote %s in %.6f seconds\n", argv[2], ((double)(clock() - start)) / CLOCKS_PER_SEC);
+    return 0;
+}
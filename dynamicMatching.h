@@ -0,0 +1,359 @@
+// Maximal matching maintained under edge insertions and deletions.
+// The matched vertices, plus the vertices with a self loop, are a
+// 2-approximate vertex cover at all times, so a changing graph does not need
+// a rebuild and a fresh greedyVertexCover run after every change.
+//
+// Updates follow Neiman and Solomon and cost O(sqrt(m)) in the worst case.
+// An insertion matches the edge if both ends are free. Deleting a matched
+// edge frees both ends, and each one then looks for a new mate:
+//   - a light vertex (degree <= sqrt(2m)) scans all its neighbors for a free one
+//   - a heavy vertex scans sqrt(2m) + 1 neighbors. If none is free, their
+//     mates are sqrt(2m) + 1 distinct vertices, and fewer than that many
+//     vertices are heavy, so one neighbor w has a light mate w'. The heavy
+//     vertex takes w, and w' looks for a mate as a light vertex.
+// A vertex that found no free neighbor stays free. All its neighbors are
+// matched then, so the matching stays maximal.
+//
+// Adjacency lists are unordered arrays. An open addressing table maps every
+// edge to its two list positions, so an edge is found and removed in O(1).
+
+#ifndef DYNAMIC_MATCHING_H
+#define DYNAMIC_MATCHING_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "graph.h"
+
+typedef struct DynamicSlot {
+    uint64_t key;     // (min << 32 | max) + 1, 0 marks an empty slot
+    int minPos;       // position of max in the list of min
+    int maxPos;       // position of min in the list of max
+} DynamicSlot;
+
+typedef struct DynamicMatching {
+    int numVertices;      // vertex ids are below this, grows on demand
+    int vertexCapacity;
+    int** adj;
+    int* adjSize;
+    int* adjCap;
+    int* mate;            // -1 when free
+    int* loops;           // self loops of each vertex, such a vertex is always covered
+    int64_t numEdges;     // distinct edges, self loops included
+    int matchedEdges;
+    int loopVertices;     // vertices with a self loop and no mate
+    DynamicSlot* slots;
+    uint64_t slotMask;    // table size - 1, the size is a power of two
+} DynamicMatching;
+
+typedef struct EdgeUpdate {
+    int u;
+    int v;
+    bool insert;          // false deletes the edge
+} EdgeUpdate;
+
+static inline void* dynamicAlloc(void* ptr, size_t bytes) {
+    ptr = realloc(ptr, bytes > 0 ? bytes : 1);
+    if (ptr == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+static inline uint64_t dynamicKey(int u, int v) {
+    uint64_t a = (uint32_t)(u < v ? u : v);
+    uint64_t b = (uint32_t)(u < v ? v : u);
+    return (a << 32 | b) + 1;
+}
+
+static inline uint64_t dynamicHash(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return key;
+}
+
+// slot holding key, or the empty slot where it would go
+static inline DynamicSlot* dynamicFind(const DynamicMatching* dm, uint64_t key) {
+    uint64_t i = dynamicHash(key) & dm->slotMask;
+    while (dm->slots[i].key != 0 && dm->slots[i].key != key) {
+        i = (i + 1) & dm->slotMask;
+    }
+    return &dm->slots[i];
+}
+
+// keep the table at most half full
+static inline void dynamicGrowTable(DynamicMatching* dm) {
+    if ((uint64_t)(dm->numEdges + 1) * 2 <= dm->slotMask + 1) return;
+    DynamicSlot* old = dm->slots;
+    uint64_t oldSize = dm->slotMask + 1;
+    dm->slotMask = 2 * oldSize - 1;
+    dm->slots = (DynamicSlot*)calloc(2 * oldSize, sizeof(DynamicSlot));
+    if (dm->slots == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (uint64_t i = 0; i < oldSize; i++) {
+        if (old[i].key != 0) *dynamicFind(dm, old[i].key) = old[i];
+    }
+    free(old);
+}
+
+// remove a slot with backward shift deletion, so lookups never see tombstones
+static inline void dynamicEraseSlot(DynamicMatching* dm, DynamicSlot* slot) {
+    uint64_t hole = (uint64_t)(slot - dm->slots);
+    uint64_t i = hole;
+    while (true) {
+        i = (i + 1) & dm->slotMask;
+        if (dm->slots[i].key == 0) break;
+        uint64_t home = dynamicHash(dm->slots[i].key) & dm->slotMask;
+        // move i into the hole unless its home lies cyclically in (hole, i]
+        bool stays = hole <= i ? (hole < home && home <= i) : (hole < home || home <= i);
+        if (!stays) {
+            dm->slots[hole] = dm->slots[i];
+            hole = i;
+        }
+    }
+    dm->slots[hole].key = 0;
+}
+
+static inline void dynamicReserveVertices(DynamicMatching* dm, int numVertices) {
+    if (numVertices <= dm->numVertices) return;
+    if (numVertices > dm->vertexCapacity) {
+        int capacity = dm->vertexCapacity > 0 ? dm->vertexCapacity : 16;
+        while (capacity < numVertices) capacity = capacity > INT32_MAX / 2 ? INT32_MAX : 2 * capacity;
+        dm->adj = (int**)dynamicAlloc(dm->adj, (size_t)capacity * sizeof(int*));
+        dm->adjSize = (int*)dynamicAlloc(dm->adjSize, (size_t)capacity * sizeof(int));
+        dm->adjCap = (int*)dynamicAlloc(dm->adjCap, (size_t)capacity * sizeof(int));
+        dm->mate = (int*)dynamicAlloc(dm->mate, (size_t)capacity * sizeof(int));
+        dm->loops = (int*)dynamicAlloc(dm->loops, (size_t)capacity * sizeof(int));
+        dm->vertexCapacity = capacity;
+    }
+    for (int v = dm->numVertices; v < numVertices; v++) {
+        dm->adj[v] = NULL;
+        dm->adjSize[v] = 0;
+        dm->adjCap[v] = 0;
+        dm->mate[v] = -1;
+        dm->loops[v] = 0;
+    }
+    dm->numVertices = numVertices;
+}
+
+static inline DynamicMatching* createDynamicMatching(int numVertices) {
+    DynamicMatching* dm = (DynamicMatching*)calloc(1, sizeof(DynamicMatching));
+    if (dm == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    dm->slotMask = 1023;
+    dm->slots = (DynamicSlot*)calloc(dm->slotMask + 1, sizeof(DynamicSlot));
+    if (dm->slots == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    dynamicReserveVertices(dm, numVertices);
+    return dm;
+}
+
+static inline void freeDynamicMatching(DynamicMatching* dm) {
+    for (int v = 0; v < dm->numVertices; v++) {
+        free(dm->adj[v]);
+    }
+    free(dm->adj);
+    free(dm->adjSize);
+    free(dm->adjCap);
+    free(dm->mate);
+    free(dm->loops);
+    free(dm->slots);
+    free(dm);
+}
+
+static inline bool dynamicIsFree(const DynamicMatching* dm, int v) {
+    return dm->mate[v] < 0 && dm->loops[v] == 0;
+}
+
+static inline void dynamicMatch(DynamicMatching* dm, int u, int v) {
+    dm->mate[u] = v;
+    dm->mate[v] = u;
+    dm->matchedEdges++;
+}
+
+static inline int dynamicHeavyLimit(const DynamicMatching* dm) {
+    return (int)sqrt(2.0 * (double)dm->numEdges);
+}
+
+// a light free vertex takes any free neighbor
+static inline void dynamicSettleLight(DynamicMatching* dm, int v) {
+    for (int i = 0; i < dm->adjSize[v]; i++) {
+        int w = dm->adj[v][i];
+        if (dynamicIsFree(dm, w)) {
+            dynamicMatch(dm, v, w);
+            return;
+        }
+    }
+}
+
+// find a mate for a vertex that just became free
+static inline void dynamicSettle(DynamicMatching* dm, int v) {
+    if (!dynamicIsFree(dm, v)) return;
+    int limit = dynamicHeavyLimit(dm);
+    if (dm->adjSize[v] <= limit) {
+        dynamicSettleLight(dm, v);
+        return;
+    }
+    // heavy: a free neighbor among the first limit + 1, or else steal from a light mate
+    int scan = limit + 1;
+    for (int i = 0; i < scan; i++) {
+        if (dynamicIsFree(dm, dm->adj[v][i])) {
+            dynamicMatch(dm, v, dm->adj[v][i]);
+            return;
+        }
+    }
+    for (int i = 0; i < scan; i++) {
+        int w = dm->adj[v][i];
+        int partner = dm->mate[w];
+        if (partner >= 0 && dm->adjSize[partner] <= limit) {
+            dm->mate[partner] = -1;
+            dm->mate[w] = v;
+            dm->mate[v] = w;
+            dynamicSettleLight(dm, partner);
+            return;
+        }
+    }
+    // only reached if the neighbors are mostly blocked by self loops: fall back to a full scan
+    dynamicSettleLight(dm, v);
+}
+
+static inline void dynamicListAppend(DynamicMatching* dm, int v, int w) {
+    if (dm->adjSize[v] == dm->adjCap[v]) {
+        dm->adjCap[v] = dm->adjCap[v] ? 2 * dm->adjCap[v] : 4;
+        dm->adj[v] = (int*)dynamicAlloc(dm->adj[v], (size_t)dm->adjCap[v] * sizeof(int));
+    }
+    dm->adj[v][dm->adjSize[v]++] = w;
+}
+
+// remove the entry at pos from the list of v, moving the last entry into it
+static inline void dynamicListRemove(DynamicMatching* dm, int v, int pos) {
+    int last = dm->adj[v][--dm->adjSize[v]];
+    if (pos == dm->adjSize[v]) return;
+    dm->adj[v][pos] = last;
+    DynamicSlot* moved = dynamicFind(dm, dynamicKey(v, last));
+    if (v < last) {
+        moved->minPos = pos;
+    } else {
+        moved->maxPos = pos;
+    }
+}
+
+// Insert edge u-v, returns false if it is already there.
+// Vertex ids beyond numVertices grow the structure.
+static inline bool dynamicInsertEdge(DynamicMatching* dm, int u, int v) {
+    if (u < 0 || v < 0) {
+        printf("Invalid vertex indices: %d or %d\n", u, v);
+        return false;
+    }
+    dynamicReserveVertices(dm, (u > v ? u : v) + 1);
+    dynamicGrowTable(dm);
+    DynamicSlot* slot = dynamicFind(dm, dynamicKey(u, v));
+    if (slot->key != 0) return false;
+    slot->key = dynamicKey(u, v);
+    dm->numEdges++;
+
+    if (u == v) {
+        // the loop covers v by itself, its mate has to look elsewhere
+        slot->minPos = slot->maxPos = -1;
+        if (dm->loops[v]++ > 0) return true;
+        int partner = dm->mate[v];
+        if (partner >= 0) {
+            dm->mate[v] = dm->mate[partner] = -1;
+            dm->matchedEdges--;
+            dynamicSettle(dm, partner);
+        }
+        dm->loopVertices++;
+        return true;
+    }
+    int a = u < v ? u : v;
+    int b = u < v ? v : u;
+    slot->minPos = dm->adjSize[a];
+    slot->maxPos = dm->adjSize[b];
+    dynamicListAppend(dm, a, b);
+    dynamicListAppend(dm, b, a);
+    if (dynamicIsFree(dm, u) && dynamicIsFree(dm, v)) {
+        dynamicMatch(dm, u, v);
+    }
+    return true;
+}
+
+// Delete edge u-v, returns false if it is not there
+static inline bool dynamicDeleteEdge(DynamicMatching* dm, int u, int v) {
+    if (u < 0 || v < 0 || u >= dm->numVertices || v >= dm->numVertices) return false;
+    DynamicSlot* slot = dynamicFind(dm, dynamicKey(u, v));
+    if (slot->key == 0) return false;
+    dm->numEdges--;
+
+    if (u == v) {
+        dynamicEraseSlot(dm, slot);
+        if (--dm->loops[v] > 0) return true;
+        dm->loopVertices--;
+        dynamicSettle(dm, v);
+        return true;
+    }
+    int a = u < v ? u : v;
+    int b = u < v ? v : u;
+    int posA = slot->minPos;
+    int posB = slot->maxPos;
+    dynamicEraseSlot(dm, slot);
+    dynamicListRemove(dm, a, posA);
+    dynamicListRemove(dm, b, posB);
+    if (dm->mate[a] == b) {
+        dm->mate[a] = dm->mate[b] = -1;
+        dm->matchedEdges--;
+        dynamicSettle(dm, a);
+        dynamicSettle(dm, b);
+    }
+    return true;
+}
+
+// Apply updates in order, returns how many changed the graph
+static inline int64_t dynamicApplyBatch(DynamicMatching* dm, const EdgeUpdate* updates, int64_t count) {
+    int64_t applied = 0;
+    for (int64_t i = 0; i < count; i++) {
+        bool changed = updates[i].insert ? dynamicInsertEdge(dm, updates[i].u, updates[i].v)
+                                         : dynamicDeleteEdge(dm, updates[i].u, updates[i].v);
+        if (changed) applied++;
+    }
+    return applied;
+}
+
+static inline int dynamicCoverSize(const DynamicMatching* dm) {
+    return 2 * dm->matchedEdges + dm->loopVertices;
+}
+
+// Snapshot of the current cover, a new array of numVertices entries
+static inline bool* dynamicCoverSnapshot(const DynamicMatching* dm) {
+    bool* cover = (bool*)calloc((size_t)dm->numVertices + 1, sizeof(bool));
+    if (cover == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < dm->numVertices; v++) {
+        cover[v] = dm->mate[v] >= 0 || dm->loops[v] > 0;
+    }
+    return cover;
+}
+
+// Start from the edges of a Graph, repeated edges are inserted once
+static inline DynamicMatching* dynamicFromGraph(const Graph* graph) {
+    DynamicMatching* dm = createDynamicMatching(graph->numVertices);
+    for (int64_t i = 0; i < graph->numEdges; i++) {
+        dynamicInsertEdge(dm, graph->edges[i].u, graph->edges[i].v);
+    }
+    return dm;
+}
+
+#endif
@@ -0,0 +1,422 @@
+// Synthetic graph generators for load testing.
+//
+// Work is cut into fixed blocks of rows or edges and block b draws from its
+// own random stream derived from (seed, b). The graph is therefore the same
+// for a given seed whatever the number of threads. Threads claim blocks from
+// a shared counter, first counting the edges of each block and then writing
+// them straight into their slice of the Graph edge array.
+//
+// Families:
+//   gnp        Erdos-Renyi G(n, p), geometric skipping so the cost is O(n + m)
+//   gnm        G(n, m) with uniform endpoints, self loops redrawn, parallel
+//              edges possible (about m^2 / n^2 of them)
+//   ba         Barabasi-Albert, every new vertex attaches degree edges by
+//              preferential attachment
+//   rmat       R-MAT / Kronecker with quadrant probabilities a, b, c, d, the
+//              vertex count is rounded up to a power of two
+//   grid       rows x cols 2D grid
+//   tree       random recursive tree, the parent of v is uniform in [0, v)
+//   bipartite  m uniform edges between left and n - left vertices
+
+#ifndef GENERATORS_H
+#define GENERATORS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include "graph.h"
+
+#define GEN_BLOCK_EDGES (1 << 16)   // edges (or tree vertices) per block
+#define GEN_GNP_ROWS 64             // G(n, p) rows per block
+
+typedef enum GraphFamily {
+    GEN_GNP,
+    GEN_GNM,
+    GEN_BA,
+    GEN_RMAT,
+    GEN_GRID,
+    GEN_TREE,
+    GEN_BIPARTITE
+} GraphFamily;
+
+typedef struct GeneratorSpec {
+    GraphFamily family;
+    int n;              // vertices (rmat: rounded up to a power of two, grid: rows * cols)
+    int64_t m;          // edges for gnm, rmat and bipartite
+    double p;           // gnp edge probability
+    int degree;         // ba edges per new vertex
+    int rows, cols;     // grid shape
+    int left;           // bipartite left side size
+    double a, b, c;     // rmat quadrant probabilities, d = 1 - a - b - c
+    uint64_t seed;
+} GeneratorSpec;
+
+static const char* const graphFamilyNames[] = {"gnp", "gnm", "ba", "rmat", "grid", "tree", "bipartite"};
+
+static inline bool parseGraphFamily(const char* name, GraphFamily* family) {
+    for (int i = 0; i < (int)(sizeof(graphFamilyNames) / sizeof(graphFamilyNames[0])); i++) {
+        if (strcmp(name, graphFamilyNames[i]) == 0) {
+            *family = (GraphFamily)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Parameters giving about n vertices and an average degree around 4
+static inline void defaultGeneratorSpec(GeneratorSpec* spec, GraphFamily family, int n, uint64_t seed) {
+    memset(spec, 0, sizeof(GeneratorSpec));
+    spec->family = family;
+    spec->n = n;
+    spec->m = 2 * (int64_t)n;
+    spec->p = n > 1 ? fmin(1.0, 4.0 / (n - 1)) : 0.0;
+    spec->degree = 2;
+    spec->cols = 1;
+    while ((int64_t)(spec->cols + 1) * (spec->cols + 1) <= n) spec->cols++;
+    spec->rows = spec->cols;
+    spec->left = n / 2;
+    spec->a = 0.57;
+    spec->b = 0.19;
+    spec->c = 0.19;
+    spec->seed = seed;
+}
+
+// --- random streams ---
+
+static inline uint64_t genMix(uint64_t z) {
+    z += 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static inline uint64_t genNext(uint64_t* state) {
+    *state += 0x9e3779b97f4a7c15ULL;
+    return genMix(*state);
+}
+
+// uniform in [0, bound) by multiply and shift, the bias is below 2^-32 for our bounds
+static inline uint64_t genBelow(uint64_t* state, uint64_t bound) {
+    return (uint64_t)(((unsigned __int128)genNext(state) * bound) >> 64);
+}
+
+// uniform in (0, 1]
+static inline double genUnit(uint64_t* state) {
+    return ((genNext(state) >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+static inline uint64_t genBlockStream(const GeneratorSpec* spec, int64_t block) {
+    return genMix(spec->seed ^ genMix((uint64_t)block + 1));
+}
+
+// --- per family block generators ---
+// Each fills out (when not NULL) with the edges of one block and returns how
+// many there are. With out == NULL only the count is wanted.
+
+static inline int rmatScale(int n) {
+    int scale = 0;
+    while (scale < 31 && (1LL << scale) < n) scale++;
+    return scale;
+}
+
+static inline int64_t genVertices(const GeneratorSpec* spec) {
+    switch (spec->family) {
+    case GEN_RMAT: return 1LL << rmatScale(spec->n);
+    case GEN_GRID: return (int64_t)spec->rows * spec->cols;
+    default: return spec->n;
+    }
+}
+
+static inline int64_t genBlocks(const GeneratorSpec* spec) {
+    int64_t items;
+    switch (spec->family) {
+    case GEN_GNP: return (spec->n + GEN_GNP_ROWS - 1) / GEN_GNP_ROWS;
+    case GEN_GRID: return spec->rows;
+    case GEN_TREE: items = spec->n > 1 ? spec->n - 1 : 0; break;
+    case GEN_BA: items = spec->n > 1 ? (int64_t)(spec->n - 1) * spec->degree : 0; break;
+    default: items = spec->m; break;
+    }
+    return (items + GEN_BLOCK_EDGES - 1) / GEN_BLOCK_EDGES;
+}
+
+// first edge index and edge count of block for the families with GEN_BLOCK_EDGES edges per block
+static inline int64_t genBlockRange(int64_t total, int64_t block, int64_t* first) {
+    *first = block * GEN_BLOCK_EDGES;
+    return total - *first < GEN_BLOCK_EDGES ? total - *first : GEN_BLOCK_EDGES;
+}
+
+static inline int64_t genGnpBlock(const GeneratorSpec* spec, int64_t block, Edge* out) {
+    uint64_t state = genBlockStream(spec, block);
+    int n = spec->n;
+    int last = (int)((block + 1) * GEN_GNP_ROWS < n ? (block + 1) * GEN_GNP_ROWS : n);
+    int64_t count = 0;
+    if (spec->p <= 0) return 0;
+    double logSkip = spec->p < 1 ? log(1.0 - spec->p) : 0;
+    for (int u = (int)(block * GEN_GNP_ROWS); u < last; u++) {
+        // jump straight to the next pair that gets an edge
+        int64_t v = u;
+        while (true) {
+            double skip = spec->p < 1 ? log(genUnit(&state)) / logSkip : 0;
+            if (skip >= n) break;
+            v += 1 + (int64_t)skip;
+            if (v >= n) break;
+            if (out) {
+                out[count].u = u;
+                out[count].v = (int)v;
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+static inline int64_t genGnmBlock(const GeneratorSpec* spec, int64_t block, Edge* out) {
+    int64_t first;
+    int64_t count = genBlockRange(spec->m, block, &first);
+    if (!out || spec->n < 2) return spec->n < 2 ? 0 : count;
+    uint64_t state = genBlockStream(spec, block);
+    for (int64_t i = 0; i < count; i++) {
+        int u, v;
+        do {
+            u = (int)genBelow(&state, spec->n);
+            v = (int)genBelow(&state, spec->n);
+        } while (u == v);
+        out[i].u = u;
+        out[i].v = v;
+    }
+    return count;
+}
+
+static inline int64_t genBipartiteBlock(const GeneratorSpec* spec, int64_t block, Edge* out) {
+    int64_t first;
+    int right = spec->n - spec->left;
+    if (spec->left < 1 || right < 1) return 0;
+    int64_t count = genBlockRange(spec->m, block, &first);
+    if (!out) return count;
+    uint64_t state = genBlockStream(spec, block);
+    for (int64_t i = 0; i < count; i++) {
+        out[i].u = (int)genBelow(&state, spec->left);
+        out[i].v = spec->left + (int)genBelow(&state, right);
+    }
+    return count;
+}
+
+static inline int64_t genRmatBlock(const GeneratorSpec* spec, int64_t block, Edge* out) {
+    int64_t first;
+    int64_t count = genBlockRange(spec->m, block, &first);
+    int scale = rmatScale(spec->n);
+    if (scale == 0) return 0;
+    if (!out) return count;
+    uint64_t state = genBlockStream(spec, block);
+    double ab = spec->a + spec->b;
+    double abc = ab + spec->c;
+    for (int64_t i = 0; i < count; i++) {
+        int u, v;
+        do {
+            u = v = 0;
+            for (int level = 0; level < scale; level++) {
+                double r = genUnit(&state);
+                int row = r > ab;
+                int col = row ? r > abc : r > spec->a;
+                u = (u << 1) | row;
+                v = (v << 1) | col;
+            }
+        } while (u == v);
+        out[i].u = u;
+        out[i].v = v;
+    }
+    return count;
+}
+
+// Barabasi-Albert in the form of Sanders and Schulz: edge e has its source
+// at position 2e and its target at 2e + 1 of a virtual endpoint list, and the
+// target copies the endpoint at a uniform earlier position. Picking a uniform
+// endpoint is picking a vertex proportionally to its degree. Copying from an
+// odd position means copying that edge's target, which is again a pure
+// function of the seed, so every edge can be resolved independently.
+static inline int baSource(const GeneratorSpec* spec, int64_t e) {
+    return (int)(e / spec->degree) + 1;
+}
+
+static inline int baTarget(const GeneratorSpec* spec, int64_t e) {
+    int source = baSource(spec, e);
+    int target = 0;  // the first edge attaches to the seed vertex
+    for (uint64_t attempt = 0; e > 0 && attempt < 64; attempt++) {
+        uint64_t state = genMix(spec->seed ^ genMix((uint64_t)e * 64 + attempt));
+        int64_t position = (int64_t)genBelow(&state, 2 * (uint64_t)e);
+        // the chain of odd positions is short: each step continues with probability 1/2
+        target = position % 2 == 0 ? baSource(spec, position / 2) : baTarget(spec, position / 2);
+        if (target != source) break;  // redraw self loops
+    }
+    return target;
+}
+
+static inline int64_t genBaBlock(const GeneratorSpec* spec, int64_t block, Edge* out) {
+    int64_t first;
+    int64_t total = spec->n > 1 ? (int64_t)(spec->n - 1) * spec->degree : 0;
+    int64_t count = genBlockRange(total, block, &first);
+    if (!out) return count;
+    for (int64_t i = 0; i < count; i++) {
+        out[i].u = baSource(spec, first + i);
+        out[i].v = baTarget(spec, first + i);
+    }
+    return count;
+}
+
+static inline int64_t genGridBlock(const GeneratorSpec* spec, int64_t block, Edge* out) {
+    int r = (int)block;
+    int cols = spec->cols;
+    int64_t count = (cols - 1) + (r + 1 < spec->rows ? cols : 0);
+    if (!out) return count;
+    int64_t k = 0;
+    for (int c = 0; c < cols; c++) {
+        int v = r * cols + c;
+        if (c + 1 < cols) {
+            out[k].u = v;
+            out[k++].v = v + 1;
+        }
+        if (r + 1 < spec->rows) {
+            out[k].u = v;
+            out[k++].v = v + cols;
+        }
+    }
+    return count;
+}
+
+// edge v - 1 joins v to its parent, so edges come out in child order
+static inline int64_t genTreeBlock(const GeneratorSpec* spec, int64_t block, Edge* out) {
+    int64_t first;
+    int64_t count = genBlockRange(spec->n > 1 ? spec->n - 1 : 0, block, &first);
+    if (!out) return count;
+    uint64_t state = genBlockStream(spec, block);
+    for (int64_t i = 0; i < count; i++) {
+        int v = (int)(first + i) + 1;
+        out[i].u = (int)genBelow(&state, v);
+        out[i].v = v;
+    }
+    return count;
+}
+
+static inline int64_t genBlock(const GeneratorSpec* spec, int64_t block, Edge* out) {
+    switch (spec->family) {
+    case GEN_GNP: return genGnpBlock(spec, block, out);
+    case GEN_GNM: return genGnmBlock(spec, block, out);
+    case GEN_BA: return genBaBlock(spec, block, out);
+    case GEN_RMAT: return genRmatBlock(spec, block, out);
+    case GEN_GRID: return genGridBlock(spec, block, out);
+    case GEN_TREE: return genTreeBlock(spec, block, out);
+    case GEN_BIPARTITE: return genBipartiteBlock(spec, block, out);
+    }
+    return 0;
+}
+
+// --- parallel driver ---
+
+typedef struct GeneratorJob {
+    const GeneratorSpec* spec;
+    int64_t numBlocks;
+    int64_t* offsets;     // numBlocks + 1, edge counts during the count pass
+    Edge* edges;          // NULL during the count pass
+    atomic_llong nextBlock;
+} GeneratorJob;
+
+static inline void* generatorWorker(void* arg) {
+    GeneratorJob* job = (GeneratorJob*)arg;
+    while (true) {
+        int64_t block = atomic_fetch_add(&job->nextBlock, 1);
+        if (block >= job->numBlocks) break;
+        if (job->edges) {
+            genBlock(job->spec, block, job->edges + job->offsets[block]);
+        } else {
+            job->offsets[block + 1] = genBlock(job->spec, block, NULL);
+        }
+    }
+    return NULL;
+}
+
+static inline void runGeneratorPass(GeneratorJob* job, int threads) {
+    atomic_store(&job->nextBlock, 0);
+    if (threads <= 1) {
+        generatorWorker(job);
+        return;
+    }
+    pthread_t* workers = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    if (!workers) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&workers[i], NULL, generatorWorker, job);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    free(workers);
+}
+
+// Generate the graph described by spec. threads <= 0 uses one per core.
+// Returns NULL after printing a message if the parameters are out of range.
+static inline Graph* generateGraph(const GeneratorSpec* spec, int threads) {
+    const char* error = NULL;
+    int64_t numVertices = genVertices(spec);
+    if (spec->n < 0 || spec->m < 0 || numVertices > INT_MAX) {
+        error = "vertex or edge count out of range";
+    } else if (spec->family == GEN_GNP && (spec->p < 0 || spec->p > 1)) {
+        error = "p must be between 0 and 1";
+    } else if (spec->family == GEN_BA && spec->degree < 1) {
+        error = "ba degree must be at least 1";
+    } else if (spec->family == GEN_GRID && (spec->rows < 1 || spec->cols < 1 || numVertices > INT_MAX)) {
+        error = "grid needs positive rows and cols";
+    } else if (spec->family == GEN_RMAT && (spec->a < 0 || spec->b < 0 || spec->c < 0 || spec->a + spec->b + spec->c > 1)) {
+        error = "rmat probabilities must be non-negative and sum to at most 1";
+    } else if (spec->family == GEN_BIPARTITE && (spec->left < 0 || spec->left > spec->n)) {
+        error = "bipartite left side must be between 0 and n";
+    }
+    if (error) {
+        fprintf(stderr, "%s: %s\n", graphFamilyNames[spec->family], error);
+        return NULL;
+    }
+
+    if (threads <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+        threads = 1;
+#endif
+    }
+
+    GeneratorJob job;
+    job.spec = spec;
+    job.numBlocks = genBlocks(spec);
+    job.offsets = (int64_t*)calloc(job.numBlocks + 1, sizeof(int64_t));
+    if (!job.offsets) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    if (threads > job.numBlocks) threads = job.numBlocks > 0 ? (int)job.numBlocks : 1;
+
+    // count pass, then prefix sums give every block its slice of the edge array
+    job.edges = NULL;
+    runGeneratorPass(&job, threads);
+    for (int64_t b = 0; b < job.numBlocks; b++) {
+        job.offsets[b + 1] += job.offsets[b];
+    }
+
+    Graph* graph = createGraph((int)numVertices, job.offsets[job.numBlocks]);
+    job.edges = graph->edges;
+    runGeneratorPass(&job, threads);
+    graph->numEdges = job.offsets[job.numBlocks];
+
+    free(job.offsets);
+    return graph;
+}
+
+#endif
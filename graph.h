@@ -0,0 +1,129 @@
+// Edge list graph shared by greedy.c, greedyV2.c and bruteforce_solution.c.
+// The edge array grows geometrically, so the expected edge count given to
+// createGraph is only a hint and any number of edges can be added.
+// Vertex costs live in one contiguous array next to the edges and are only
+// allocated once a weight is set, so unit cost graphs carry no extra memory.
+
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "instrument.h"
+
+typedef struct Edge {
+    int u;
+    int v;
+} Edge;
+
+typedef struct Graph {
+    int numVertices;
+    int64_t numEdges;
+    int64_t capacity;
+    Edge* edges;
+    int64_t* weights;   // cost of every vertex, NULL when all costs are 1
+} Graph;
+
+// make room for at least minCapacity edges, doubling so repeated adds stay amortized O(1)
+static inline void reserveEdges(Graph* graph, int64_t minCapacity) {
+    if (minCapacity <= graph->capacity) return;
+    int64_t capacity = graph->capacity > 0 ? graph->capacity : 16;
+    while (capacity < minCapacity) {
+        capacity *= 2;
+    }
+    Edge* edges = (Edge*)realloc(graph->edges, (size_t)capacity * sizeof(Edge));
+    if (edges == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    graph->edges = edges;
+    graph->capacity = capacity;
+}
+
+static inline Graph* createGraph(int numVertices, int64_t expectedEdges) {
+    Graph* graph = (Graph*)malloc(sizeof(Graph));
+    if (graph == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    graph->numVertices = numVertices;
+    graph->numEdges = 0;
+    graph->capacity = 0;
+    graph->edges = NULL;
+    graph->weights = NULL;
+    reserveEdges(graph, expectedEdges > 0 ? expectedEdges : 1);
+    return graph;
+}
+
+static inline void addEdge(Graph* graph, int u, int v) {
+    if (u >= 0 && u < graph->numVertices && v >= 0 && v < graph->numVertices) {
+        reserveEdges(graph, graph->numEdges + 1);
+        graph->edges[graph->numEdges].u = u;
+        graph->edges[graph->numEdges].v = v;
+        graph->numEdges++;
+    } else {
+        printf("Invalid vertex indices: %d or %d\n", u, v);
+    }
+}
+
+// Bulk ingestion: one reservation and one copy for the whole array.
+// Edges with an endpoint out of range are reported and skipped.
+static inline void addEdges(Graph* graph, const Edge* edges, int64_t count) {
+    reserveEdges(graph, graph->numEdges + count);
+    Edge* out = graph->edges + graph->numEdges;
+    int64_t added = 0;
+    for (int64_t i = 0; i < count; i++) {
+        int u = edges[i].u;
+        int v = edges[i].v;
+        if (u >= 0 && u < graph->numVertices && v >= 0 && v < graph->numVertices) {
+            out[added++] = edges[i];
+        } else {
+            printf("Invalid vertex indices: %d or %d\n", u, v);
+        }
+    }
+    graph->numEdges += added;
+}
+
+// Set the cost of v, the other vertices keep cost 1 the first time this is called
+static inline void setVertexWeight(Graph* graph, int v, int64_t weight) {
+    if (v < 0 || v >= graph->numVertices) {
+        printf("Invalid vertex index: %d\n", v);
+        return;
+    }
+    if (graph->weights == NULL) {
+        graph->weights = (int64_t*)malloc(((size_t)graph->numVertices + 1) * sizeof(int64_t));
+        if (graph->weights == NULL) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        for (int i = 0; i < graph->numVertices; i++) {
+            graph->weights[i] = 1;
+        }
+    }
+    graph->weights[v] = weight;
+}
+
+static inline int64_t vertexWeight(const Graph* graph, int v) {
+    return graph->weights ? graph->weights[v] : 1;
+}
+
+// total cost of the vertices in cover
+static inline int64_t coverWeight(const Graph* graph, const bool* cover) {
+    int64_t total = 0;
+    for (int v = 0; v < graph->numVertices; v++) {
+        if (cover[v]) total += vertexWeight(graph, v);
+    }
+    return total;
+}
+
+static inline void freeGraph(Graph* graph) {
+    free(graph->edges);
+    free(graph->weights);
+    free(graph);
+}
+
+#endif
@@ -0,0 +1,88 @@
+// Compressed sparse row adjacency over a Graph edge list, the one adjacency
+// layout the solvers share. A snapshot stores it on disk and openSnapshot maps
+// it without copying, so a solver that takes a CSRGraph runs on a built CSR
+// and on a mapped snapshot alike. Solvers treat a CSRGraph as read only.
+//
+// The neighbors of vertex v are neighbors[offsets[v]] .. neighbors[offsets[v + 1] - 1].
+// An edge u-v is listed under u and under v, in edge order, and edgeIds
+// holds the index into graph->edges of each of those entries.
+
+#ifndef GRAPH_CSR_H
+#define GRAPH_CSR_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "graph.h"
+
+typedef struct CSRGraph {
+    int numVertices;
+    int64_t numEdges;
+    int64_t* offsets;
+    int* neighbors;
+    int64_t* edgeIds;   // NULL when built without edge ids
+} CSRGraph;
+
+// CSR of an edge list, edgeIds is filled when withEdgeIds is set
+static inline CSRGraph* buildCSREdges(int numVertices, const Edge* edges, int64_t numEdges, bool withEdgeIds) {
+    INSTR_PHASE_BEGIN(PHASE_BUILD);
+    CSRGraph* csr = (CSRGraph*)malloc(sizeof(CSRGraph));
+    int64_t* offsets = (int64_t*)calloc(numVertices + 2, sizeof(int64_t));
+    int* neighbors = (int*)malloc((2 * numEdges + 1) * sizeof(int));
+    int64_t* edgeIds = withEdgeIds ? (int64_t*)malloc((2 * numEdges + 1) * sizeof(int64_t)) : NULL;
+    if (csr == NULL || offsets == NULL || neighbors == NULL || (withEdgeIds && edgeIds == NULL)) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    // count degrees one slot ahead, so after the prefix sum offsets[v + 1] is
+    // the fill cursor of v and ends as the start of v + 1
+    for (int64_t i = 0; i < numEdges; i++) {
+        offsets[edges[i].u + 2]++;
+        offsets[edges[i].v + 2]++;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 2] += offsets[v + 1];
+    }
+    for (int64_t i = 0; i < numEdges; i++) {
+        int u = edges[i].u;
+        int v = edges[i].v;
+        if (edgeIds) edgeIds[offsets[u + 1]] = i;
+        neighbors[offsets[u + 1]++] = v;
+        if (edgeIds) edgeIds[offsets[v + 1]] = i;
+        neighbors[offsets[v + 1]++] = u;
+    }
+
+    csr->numVertices = numVertices;
+    csr->numEdges = numEdges;
+    csr->offsets = offsets;
+    csr->neighbors = neighbors;
+    csr->edgeIds = edgeIds;
+    INSTR_PHASE_END(PHASE_BUILD);
+    return csr;
+}
+
+static inline CSRGraph* buildCSR(const Graph* graph) {
+    return buildCSREdges(graph->numVertices, graph->edges, graph->numEdges, true);
+}
+
+// neighbors only, for solvers that never need to know which edge they crossed
+static inline CSRGraph* buildNeighborCSR(const Graph* graph) {
+    return buildCSREdges(graph->numVertices, graph->edges, graph->numEdges, false);
+}
+
+static inline int64_t csrDegree(const CSRGraph* csr, int v) {
+    return csr->offsets[v + 1] - csr->offsets[v];
+}
+
+// only for a CSR from one of the build functions, never for a snapshot view
+static inline void freeCSR(CSRGraph* csr) {
+    free(csr->offsets);
+    free(csr->neighbors);
+    free(csr->edgeIds);
+    free(csr);
+}
+
+#endif
@@ -0,0 +1,621 @@
+// Graph file loaders and writers for the edge list programs.
+// The file is memory mapped and parsed in place with a hand written integer
+// scanner. Large files are cut into chunks at line boundaries and the chunks
+// are parsed by one thread each, every thread filling its own edge buffer that
+// is then appended to the Graph in one copy.
+//
+// Formats:
+//   edge list  one "u v" pair per line, 0-based, '#' and '%' start comments,
+//              anything after the second number on a line is ignored
+//   DIMACS     .col / .clq: "p edge N M" header and "e u v" lines, 1-based,
+//              optional "n v w" lines give vertex v the cost w
+//   METIS      .graph / .metis: "n m [fmt [ncon]]" header, then line i lists
+//              the neighbors of vertex i (1-based); the first vertex weight
+//              becomes the cost of i, edge weights are skipped
+//
+// writeGraphText writes the edge list and DIMACS formats back out.
+
+#ifndef GRAPH_LOADER_H
+#define GRAPH_LOADER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#define GRAPH_LOADER_NO_MMAP
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "graph.h"
+
+// files smaller than this are parsed by a single thread
+#define LOADER_PARALLEL_THRESHOLD (4 << 20)
+
+typedef enum GraphFormat {
+    FORMAT_AUTO,      // pick by file extension
+    FORMAT_EDGE_LIST,
+    FORMAT_DIMACS,
+    FORMAT_METIS
+} GraphFormat;
+
+// A file mapped (or read) into memory
+typedef struct MappedFile {
+    const char* data;
+    size_t size;
+    bool mapped;
+} MappedFile;
+
+static inline bool mapFile(const char* path, MappedFile* file) {
+    file->data = NULL;
+    file->size = 0;
+    file->mapped = false;
+#ifndef GRAPH_LOADER_NO_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror(path);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        perror(path);
+        close(fd);
+        return false;
+    }
+    file->size = (size_t)st.st_size;
+    if (file->size > 0) {
+        void* data = mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            perror(path);
+            close(fd);
+            return false;
+        }
+        madvise(data, file->size, MADV_SEQUENTIAL);
+        file->data = (const char*)data;
+        file->mapped = true;
+    }
+    close(fd);
+    return true;
+#else
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        perror(path);
+        return false;
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char* data = (char*)malloc(size > 0 ? size : 1);
+    if (!data) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    file->size = fread(data, 1, size, fp);
+    file->data = data;
+    fclose(fp);
+    return true;
+#endif
+}
+
+static inline void unmapFile(MappedFile* file) {
+#ifndef GRAPH_LOADER_NO_MMAP
+    if (file->mapped) munmap((void*)file->data, file->size);
+#else
+    free((void*)file->data);
+#endif
+}
+
+// --- scanner ---
+
+static inline const char* skipBlanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+    return p;
+}
+
+static inline const char* skipLine(const char* p, const char* end) {
+    const char* newline = (const char*)memchr(p, '\n', end - p);
+    return newline ? newline + 1 : end;
+}
+
+// Read an unsigned decimal integer, returns NULL if there is none at p
+static inline const char* scanNumber(const char* p, const char* end, int64_t* value) {
+    p = skipBlanks(p, end);
+    if (p == end || *p < '0' || *p > '9') return NULL;
+    int64_t x = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        x = x * 10 + (*p - '0');
+        if (x > INT_MAX) return NULL;
+        p++;
+    }
+    *value = x;
+    return p;
+}
+
+// --- chunked parsing ---
+
+typedef struct LoaderChunk {
+    const char* begin;
+    const char* end;
+    GraphFormat format;
+    int64_t firstVertex;  // METIS: vertex id of the first line in the chunk
+    Edge* edges;
+    int64_t numEdges;
+    int64_t capacity;
+    int64_t maxVertex;
+    int64_t lines;        // METIS: vertex lines seen
+    int64_t* weights;     // (vertex, cost) pairs
+    int64_t numWeights;
+    int64_t weightCapacity;
+    const char* error;    // position of the first malformed line, NULL if none
+} LoaderChunk;
+
+static inline void chunkPush(LoaderChunk* chunk, int64_t u, int64_t v) {
+    if (chunk->numEdges == chunk->capacity) {
+        chunk->capacity = chunk->capacity ? 2 * chunk->capacity : 4096;
+        chunk->edges = (Edge*)realloc(chunk->edges, (size_t)chunk->capacity * sizeof(Edge));
+        if (!chunk->edges) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    chunk->edges[chunk->numEdges].u = (int)u;
+    chunk->edges[chunk->numEdges].v = (int)v;
+    chunk->numEdges++;
+    if (u > chunk->maxVertex) chunk->maxVertex = u;
+    if (v > chunk->maxVertex) chunk->maxVertex = v;
+}
+
+static inline void chunkPushWeight(LoaderChunk* chunk, int64_t v, int64_t weight) {
+    if (chunk->numWeights == chunk->weightCapacity) {
+        chunk->weightCapacity = chunk->weightCapacity ? 2 * chunk->weightCapacity : 1024;
+        chunk->weights = (int64_t*)realloc(chunk->weights, (size_t)chunk->weightCapacity * 2 * sizeof(int64_t));
+        if (!chunk->weights) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    chunk->weights[2 * chunk->numWeights] = v;
+    chunk->weights[2 * chunk->numWeights + 1] = weight;
+    chunk->numWeights++;
+    if (v > chunk->maxVertex) chunk->maxVertex = v;
+}
+
+static inline bool isMetisComment(const char* p, const char* end) {
+    return p < end && *p == '%';
+}
+
+static inline void parseEdgeListChunk(LoaderChunk* chunk) {
+    const char* p = chunk->begin;
+    const char* end = chunk->end;
+    while (p < end) {
+        const char* line = p;
+        p = skipBlanks(p, end);
+        if (p == end || *p == '\n' || *p == '#' || *p == '%') {
+            p = skipLine(p, end);
+            continue;
+        }
+        int64_t u, v;
+        p = scanNumber(p, end, &u);
+        if (p) p = scanNumber(p, end, &v);
+        if (!p) {
+            if (!chunk->error) chunk->error = line;
+            p = skipLine(line, end);
+            continue;
+        }
+        chunkPush(chunk, u, v);
+        p = skipLine(p, end);
+    }
+}
+
+static inline void parseDimacsChunk(LoaderChunk* chunk) {
+    const char* p = chunk->begin;
+    const char* end = chunk->end;
+    while (p < end) {
+        const char* line = p;
+        p = skipBlanks(p, end);
+        if (p < end && *p == 'e') {
+            int64_t u, v;
+            p = scanNumber(p + 1, end, &u);
+            if (p) p = scanNumber(p, end, &v);
+            if (!p || u < 1 || v < 1) {
+                if (!chunk->error) chunk->error = line;
+                p = skipLine(line, end);
+                continue;
+            }
+            chunkPush(chunk, u - 1, v - 1);
+        } else if (p < end && *p == 'n') {
+            int64_t v, weight;
+            p = scanNumber(p + 1, end, &v);
+            if (p) p = scanNumber(p, end, &weight);
+            if (!p || v < 1 || weight < 0) {
+                if (!chunk->error) chunk->error = line;
+                p = skipLine(line, end);
+                continue;
+            }
+            chunkPushWeight(chunk, v - 1, weight);
+        }
+        // 'c' comments, the 'p' header (read separately) and blank lines
+        p = skipLine(p, end);
+    }
+}
+
+// Every non comment line is one vertex, its weights come first as the header says
+typedef struct MetisHeader {
+    int64_t numVertices;
+    int64_t numEdges;
+    bool edgeWeights;
+    int vertexWeights;
+} MetisHeader;
+
+static inline void parseMetisChunk(LoaderChunk* chunk, const MetisHeader* header) {
+    const char* p = chunk->begin;
+    const char* end = chunk->end;
+    int64_t vertex = chunk->firstVertex;
+    while (p < end) {
+        const char* line = p;
+        if (isMetisComment(p, end)) {
+            p = skipLine(p, end);
+            continue;
+        }
+        // blank lines past the declared vertices are trailing newlines, not vertices
+        if (vertex >= header->numVertices) {
+            const char* rest = skipBlanks(p, end);
+            if (rest == end || *rest == '\n') {
+                p = skipLine(rest, end);
+                continue;
+            }
+        }
+        int64_t value;
+        for (int i = 0; i < header->vertexWeights && p; i++) {
+            p = scanNumber(p, end, &value);
+            if (p && i == 0) chunkPushWeight(chunk, vertex, value);
+        }
+        while (p) {
+            const char* next = scanNumber(p, end, &value);
+            if (!next) break;
+            p = next;
+            if (value < 1 || value > header->numVertices) {
+                p = NULL;
+                break;
+            }
+            // every edge is listed by both endpoints, keep one copy
+            if (value - 1 > vertex) chunkPush(chunk, vertex, value - 1);
+            if (header->edgeWeights) {
+                p = scanNumber(p, end, &value);
+            }
+        }
+        if (!p) {
+            if (!chunk->error) chunk->error = line;
+            p = line;
+        } else {
+            p = skipBlanks(p, end);
+            if (p < end && *p != '\n' && !chunk->error) chunk->error = line;
+        }
+        p = skipLine(p, end);
+        vertex++;
+        chunk->lines++;
+    }
+    if (vertex - 1 > chunk->maxVertex) chunk->maxVertex = vertex - 1;
+}
+
+// count METIS vertex lines (non comment lines) in a chunk
+static inline int64_t countMetisLines(const char* p, const char* end) {
+    int64_t lines = 0;
+    while (p < end) {
+        if (!isMetisComment(p, end)) lines++;
+        p = skipLine(p, end);
+    }
+    return lines;
+}
+
+typedef struct LoaderJob {
+    LoaderChunk* chunk;
+    const MetisHeader* header;
+    bool countOnly;
+} LoaderJob;
+
+static inline void* loaderThread(void* arg) {
+    LoaderJob* job = (LoaderJob*)arg;
+    LoaderChunk* chunk = job->chunk;
+    if (job->countOnly) {
+        chunk->lines = countMetisLines(chunk->begin, chunk->end);
+    } else if (chunk->format == FORMAT_EDGE_LIST) {
+        parseEdgeListChunk(chunk);
+    } else if (chunk->format == FORMAT_DIMACS) {
+        parseDimacsChunk(chunk);
+    } else {
+        parseMetisChunk(chunk, job->header);
+    }
+    return NULL;
+}
+
+static inline void runLoaderJobs(LoaderJob* jobs, int count) {
+    if (count == 1) {
+        loaderThread(&jobs[0]);
+        return;
+    }
+    pthread_t* threads = (pthread_t*)malloc(count * sizeof(pthread_t));
+    if (!threads) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < count; i++) {
+        pthread_create(&threads[i], NULL, loaderThread, &jobs[i]);
+    }
+    for (int i = 0; i < count; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+}
+
+static inline GraphFormat formatFromPath(const char* path) {
+    const char* dot = strrchr(path, '.');
+    if (dot && (strcmp(dot, ".col") == 0 || strcmp(dot, ".clq") == 0 || strcmp(dot, ".dimacs") == 0)) {
+        return FORMAT_DIMACS;
+    }
+    if (dot && (strcmp(dot, ".graph") == 0 || strcmp(dot, ".metis") == 0)) {
+        return FORMAT_METIS;
+    }
+    return FORMAT_EDGE_LIST;
+}
+
+// Read the header line of a DIMACS or METIS file, returns where the body starts or NULL
+static inline const char* readHeader(const char* p, const char* end, GraphFormat format, MetisHeader* header) {
+    memset(header, 0, sizeof(MetisHeader));
+    header->numVertices = -1;
+    while (p < end) {
+        const char* line = skipBlanks(p, end);
+        if (format == FORMAT_DIMACS && line < end && *line == 'p') {
+            // "p edge N M", the format word is not checked
+            const char* q = line + 1;
+            q = skipBlanks(q, end);
+            while (q < end && *q != ' ' && *q != '\t' && *q != '\n') q++;
+            q = scanNumber(q, end, &header->numVertices);
+            if (q) q = scanNumber(q, end, &header->numEdges);
+            return q ? skipLine(q, end) : NULL;
+        }
+        if (format == FORMAT_METIS && line < end && *line != '%' && *line != '\n') {
+            int64_t fmt = 0, ncon = 0;
+            const char* q = scanNumber(line, end, &header->numVertices);
+            if (q) q = scanNumber(q, end, &header->numEdges);
+            if (!q) return NULL;
+            const char* more = scanNumber(q, end, &fmt);
+            if (more) {
+                q = more;
+                more = scanNumber(q, end, &ncon);
+                if (more) q = more;
+            }
+            // fmt is written in decimal digits: 1 = edge weights, 10 = vertex weights
+            header->edgeWeights = fmt % 10 == 1;
+            header->vertexWeights = (fmt / 10) % 10 == 1 ? (ncon > 0 ? (int)ncon : 1) : 0;
+            return skipLine(q, end);
+        }
+        p = skipLine(p, end);
+    }
+    return NULL;
+}
+
+// Cut [begin, end) into count pieces that end on line boundaries
+static inline int splitChunks(const char* begin, const char* end, int count, LoaderChunk* chunks, GraphFormat format) {
+    int made = 0;
+    const char* p = begin;
+    size_t step = (size_t)(end - begin) / count + 1;
+    while (p < end && made < count) {
+        const char* cut = (size_t)(end - p) > step ? p + step : end;
+        if (cut < end) cut = skipLine(cut, end);
+        memset(&chunks[made], 0, sizeof(LoaderChunk));
+        chunks[made].begin = p;
+        chunks[made].end = cut;
+        chunks[made].format = format;
+        chunks[made].maxVertex = -1;
+        made++;
+        p = cut;
+    }
+    return made;
+}
+
+// Load a graph file. Returns NULL after printing a message if the file cannot be
+// read or is malformed. threads <= 0 uses one thread per core for large files.
+static inline Graph* loadGraphThreads(const char* path, GraphFormat format, int threads) {
+    if (format == FORMAT_AUTO) format = formatFromPath(path);
+
+    MappedFile file;
+    if (!mapFile(path, &file)) return NULL;
+    const char* begin = file.data;
+    const char* end = file.data + file.size;
+
+    MetisHeader header;
+    memset(&header, 0, sizeof(header));
+    header.numVertices = -1;
+    if (format != FORMAT_EDGE_LIST) {
+        begin = file.size ? readHeader(begin, end, format, &header) : NULL;
+        if (!begin) {
+            fprintf(stderr, "%s: missing or malformed header\n", path);
+            unmapFile(&file);
+            return NULL;
+        }
+    }
+
+    if (threads <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+        threads = 1;
+#endif
+    }
+    if (file.size < LOADER_PARALLEL_THRESHOLD || threads < 1) threads = 1;
+
+    LoaderChunk* chunks = (LoaderChunk*)malloc(threads * sizeof(LoaderChunk));
+    LoaderJob* jobs = (LoaderJob*)malloc(threads * sizeof(LoaderJob));
+    if (!chunks || !jobs) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int count = splitChunks(begin, end, threads, chunks, format);
+    for (int i = 0; i < count; i++) {
+        jobs[i].chunk = &chunks[i];
+        jobs[i].header = &header;
+        jobs[i].countOnly = false;
+    }
+
+    // METIS vertex ids come from line numbers, so count lines per chunk first
+    if (format == FORMAT_METIS && count > 1) {
+        for (int i = 0; i < count; i++) jobs[i].countOnly = true;
+        runLoaderJobs(jobs, count);
+        int64_t first = 0;
+        for (int i = 0; i < count; i++) {
+            chunks[i].firstVertex = first;
+            first += chunks[i].lines;
+            chunks[i].lines = 0;
+            jobs[i].countOnly = false;
+        }
+    }
+    if (count > 0) runLoaderJobs(jobs, count);
+
+    int64_t totalEdges = 0;
+    int64_t maxVertex = -1;
+    const char* error = NULL;
+    for (int i = 0; i < count; i++) {
+        totalEdges += chunks[i].numEdges;
+        if (chunks[i].maxVertex > maxVertex) maxVertex = chunks[i].maxVertex;
+        if (!error && chunks[i].error) error = chunks[i].error;
+    }
+
+    int64_t numVertices = header.numVertices >= 0 ? header.numVertices : maxVertex + 1;
+    if (!error && numVertices > INT_MAX) {
+        fprintf(stderr, "%s: %lld vertices are more than the %d a graph can hold\n",
+                path, (long long)numVertices, INT_MAX);
+        error = end;
+    } else if (!error && maxVertex >= numVertices) {
+        fprintf(stderr, "%s: vertex %lld is outside the %lld declared vertices\n",
+                path, (long long)maxVertex + 1, (long long)numVertices);
+        error = end;
+    } else if (error) {
+        fprintf(stderr, "%s: malformed line at byte %lld\n", path, (long long)(error - file.data));
+    }
+
+    Graph* graph = NULL;
+    if (!error) {
+        graph = createGraph((int)numVertices, totalEdges);
+        for (int i = 0; i < count; i++) {
+            addEdges(graph, chunks[i].edges, chunks[i].numEdges);
+            for (int64_t w = 0; w < chunks[i].numWeights; w++) {
+                setVertexWeight(graph, (int)chunks[i].weights[2 * w], chunks[i].weights[2 * w + 1]);
+            }
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        free(chunks[i].edges);
+        free(chunks[i].weights);
+    }
+    free(chunks);
+    free(jobs);
+    unmapFile(&file);
+    return graph;
+}
+
+static inline Graph* loadGraph(const char* path, GraphFormat format) {
+    return loadGraphThreads(path, format, 0);
+}
+
+
+// --- writers ---
+
+typedef struct TextWriter {
+    FILE* fp;
+    char* buffer;
+    size_t used;
+    bool failed;
+} TextWriter;
+
+#define WRITER_BUFFER_SIZE (1 << 20)
+
+static inline void writerFlush(TextWriter* writer) {
+    if (writer->used > 0 && fwrite(writer->buffer, 1, writer->used, writer->fp) != writer->used) {
+        writer->failed = true;
+    }
+    writer->used = 0;
+}
+
+// append a decimal number and a separator without going through printf
+static inline void writerNumber(TextWriter* writer, int64_t value, char separator) {
+    if (writer->used + 24 > WRITER_BUFFER_SIZE) writerFlush(writer);
+    char digits[24];
+    int length = 0;
+    do {
+        digits[length++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    char* out = writer->buffer + writer->used;
+    for (int i = 0; i < length; i++) {
+        out[i] = digits[length - 1 - i];
+    }
+    out[length] = separator;
+    writer->used += length + 1;
+}
+
+static inline void writerText(TextWriter* writer, const char* text) {
+    size_t length = strlen(text);
+    if (writer->used + length > WRITER_BUFFER_SIZE) writerFlush(writer);
+    memcpy(writer->buffer + writer->used, text, length);
+    writer->used += length;
+}
+
+// Write graph as an edge list or, for FORMAT_DIMACS, as a DIMACS file with its
+// vertex costs. Edge lists have no place for costs, they are dropped.
+// path "-" writes to stdout. Returns false after printing a message on failure.
+static inline bool writeGraphText(const char* path, const Graph* graph, GraphFormat format) {
+    if (format == FORMAT_AUTO) format = formatFromPath(path);
+    if (format == FORMAT_METIS) {
+        fprintf(stderr, "%s: writing METIS files is not supported\n", path);
+        return false;
+    }
+    bool toStdout = strcmp(path, "-") == 0;
+    TextWriter writer;
+    writer.fp = toStdout ? stdout : fopen(path, "wb");
+    writer.buffer = (char*)malloc(WRITER_BUFFER_SIZE);
+    writer.used = 0;
+    writer.failed = false;
+    if (writer.buffer == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    if (writer.fp == NULL) {
+        perror(path);
+        free(writer.buffer);
+        return false;
+    }
+
+    int base = format == FORMAT_DIMACS ? 1 : 0;
+    if (format == FORMAT_DIMACS) {
+        writerText(&writer, "p edge ");
+        writerNumber(&writer, graph->numVertices, ' ');
+        writerNumber(&writer, graph->numEdges, '\n');
+        for (int v = 0; graph->weights && v < graph->numVertices; v++) {
+            writerText(&writer, "n ");
+            writerNumber(&writer, v + 1, ' ');
+            writerNumber(&writer, graph->weights[v], '\n');
+        }
+    }
+    for (int64_t i = 0; i < graph->numEdges; i++) {
+        if (base) writerText(&writer, "e ");
+        writerNumber(&writer, graph->edges[i].u + base, ' ');
+        writerNumber(&writer, graph->edges[i].v + base, '\n');
+    }
+    writerFlush(&writer);
+    if (toStdout ? fflush(stdout) != 0 : fclose(writer.fp) != 0) writer.failed = true;
+    if (writer.failed) perror(path);
+    free(writer.buffer);
+    return !writer.failed;
+}
+
+#endif
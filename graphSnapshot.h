@@ -0,0 +1,184 @@
+// Binary graph snapshots: a graph in the exact layout the solvers use, so a
+// run only maps the file and checks the header instead of parsing text.
+//
+// Layout (native byte order, every section starts on a 64 byte boundary):
+//   SnapshotHeader
+//   edges      numEdges Edge            the Graph edge array
+//   offsets    numVertices + 1 int64_t  CSR start of each vertex
+//   neighbors  2 * numEdges int         CSR neighbor of each slot
+//   edgeIds    2 * numEdges int64_t     CSR edge index of each slot
+//   weights    numVertices int64_t      vertex costs, only for weighted graphs
+//
+// The CSR sections are the arrays of buildCSR in graphCSR.h.
+
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+
+#include "graph.h"
+#include "graphCSR.h"
+#include "graphLoader.h"
+
+#define SNAPSHOT_MAGIC "VCGRAPH"
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+#define SNAPSHOT_ALIGN 64
+
+typedef struct SnapshotHeader {
+    char magic[8];        // SNAPSHOT_MAGIC with its terminating zero
+    uint32_t version;
+    uint32_t byteOrder;   // SNAPSHOT_BYTE_ORDER as written by the producer
+    int64_t numVertices;
+    int64_t numEdges;
+    uint64_t edgesPos;    // byte offsets of the sections from the start of the file
+    uint64_t offsetsPos;
+    uint64_t neighborsPos;
+    uint64_t edgeIdsPos;
+    uint64_t weightsPos;  // 0 when every vertex costs 1
+    uint64_t fileSize;
+} SnapshotHeader;
+
+// A mapped snapshot. graph and csr point into the mapping and are read only:
+// do not call freeGraph, addEdge or freeCSR on them, use closeSnapshot.
+typedef struct GraphSnapshot {
+    MappedFile file;
+    Graph graph;
+    CSRGraph csr;
+} GraphSnapshot;
+
+static inline uint64_t snapshotAlign(uint64_t pos) {
+    return (pos + SNAPSHOT_ALIGN - 1) & ~(uint64_t)(SNAPSHOT_ALIGN - 1);
+}
+
+static inline void snapshotLayout(SnapshotHeader* header, int64_t numVertices, int64_t numEdges, bool weighted) {
+    memset(header, 0, sizeof(SnapshotHeader));
+    memcpy(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic));
+    header->version = SNAPSHOT_VERSION;
+    header->byteOrder = SNAPSHOT_BYTE_ORDER;
+    header->numVertices = numVertices;
+    header->numEdges = numEdges;
+    header->edgesPos = snapshotAlign(sizeof(SnapshotHeader));
+    header->offsetsPos = snapshotAlign(header->edgesPos + (uint64_t)numEdges * sizeof(Edge));
+    header->neighborsPos = snapshotAlign(header->offsetsPos + (uint64_t)(numVertices + 1) * sizeof(int64_t));
+    header->edgeIdsPos = snapshotAlign(header->neighborsPos + (uint64_t)(2 * numEdges) * sizeof(int));
+    header->fileSize = header->edgeIdsPos + (uint64_t)(2 * numEdges) * sizeof(int64_t);
+    if (weighted) {
+        header->weightsPos = snapshotAlign(header->fileSize);
+        header->fileSize = header->weightsPos + (uint64_t)numVertices * sizeof(int64_t);
+    }
+}
+
+// true if the file starts with the snapshot magic
+static inline bool isSnapshotFile(const char* path) {
+    char magic[8];
+    FILE* fp = fopen(path, "rb");
+    if (!fp) return false;
+    bool match = fread(magic, 1, sizeof(magic), fp) == sizeof(magic) &&
+                 memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0;
+    fclose(fp);
+    return match;
+}
+
+static inline bool writeSection(FILE* fp, uint64_t* pos, uint64_t target, const void* data, size_t bytes) {
+    static const char padding[SNAPSHOT_ALIGN] = {0};
+    if (target - *pos > 0 && fwrite(padding, 1, target - *pos, fp) != target - *pos) return false;
+    if (bytes > 0 && fwrite(data, 1, bytes, fp) != bytes) return false;
+    *pos = target + bytes;
+    return true;
+}
+
+// Write graph as a snapshot, returns false after printing a message on failure
+static inline bool writeSnapshot(const char* path, const Graph* graph) {
+    int numVertices = graph->numVertices;
+    int64_t numEdges = graph->numEdges;
+    const Edge* edges = graph->edges;
+
+    CSRGraph* csr = buildCSR(graph);
+
+    SnapshotHeader header;
+    snapshotLayout(&header, numVertices, numEdges, graph->weights != NULL);
+
+    bool ok = false;
+    FILE* fp = fopen(path, "wb");
+    if (fp) {
+        uint64_t pos = 0;
+        ok = writeSection(fp, &pos, 0, &header, sizeof(header)) &&
+             writeSection(fp, &pos, header.edgesPos, edges, (size_t)numEdges * sizeof(Edge)) &&
+             writeSection(fp, &pos, header.offsetsPos, csr->offsets, (size_t)(numVertices + 1) * sizeof(int64_t)) &&
+             writeSection(fp, &pos, header.neighborsPos, csr->neighbors, (size_t)(2 * numEdges) * sizeof(int)) &&
+             writeSection(fp, &pos, header.edgeIdsPos, csr->edgeIds, (size_t)(2 * numEdges) * sizeof(int64_t)) &&
+             (graph->weights == NULL ||
+              writeSection(fp, &pos, header.weightsPos, graph->weights, (size_t)numVertices * sizeof(int64_t)));
+        if (fclose(fp) != 0) ok = false;
+    }
+    if (!ok) perror(path);
+
+    freeCSR(csr);
+    return ok;
+}
+
+// Map a snapshot. Only the header and the two ends of the offsets array are
+// checked, the body is trusted to be what writeSnapshot produced.
+static inline GraphSnapshot* openSnapshot(const char* path) {
+    GraphSnapshot* snapshot = (GraphSnapshot*)malloc(sizeof(GraphSnapshot));
+    if (snapshot == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    if (!mapFile(path, &snapshot->file)) {
+        free(snapshot);
+        return NULL;
+    }
+
+    const char* error = NULL;
+    const SnapshotHeader* header = (const SnapshotHeader*)snapshot->file.data;
+    SnapshotHeader expected;
+    if (snapshot->file.size < sizeof(SnapshotHeader) ||
+        memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0) {
+        error = "not a graph snapshot";
+    } else if (header->version != SNAPSHOT_VERSION) {
+        error = "unsupported snapshot version, convert the graph again";
+    } else if (header->byteOrder != SNAPSHOT_BYTE_ORDER) {
+        error = "snapshot was written with a different byte order";
+    } else if (header->numVertices < 0 || header->numVertices > INT_MAX ||
+               header->numEdges < 0 || header->numEdges > INT64_MAX / 16) {
+        error = "corrupt snapshot header";
+    } else {
+        snapshotLayout(&expected, header->numVertices, header->numEdges, header->weightsPos != 0);
+        if (memcmp(header, &expected, sizeof(SnapshotHeader)) != 0 ||
+            snapshot->file.size != header->fileSize) {
+            error = "corrupt snapshot header or truncated file";
+        }
+    }
+
+    if (error == NULL) {
+        const char* base = snapshot->file.data;
+        snapshot->graph.numVertices = (int)header->numVertices;
+        snapshot->graph.numEdges = header->numEdges;
+        snapshot->graph.capacity = header->numEdges;
+        snapshot->graph.edges = (Edge*)(base + header->edgesPos);
+        snapshot->graph.weights = header->weightsPos ? (int64_t*)(base + header->weightsPos) : NULL;
+        snapshot->csr.numVertices = (int)header->numVertices;
+        snapshot->csr.numEdges = header->numEdges;
+        snapshot->csr.offsets = (int64_t*)(base + header->offsetsPos);
+        snapshot->csr.neighbors = (int*)(base + header->neighborsPos);
+        snapshot->csr.edgeIds = (int64_t*)(base + header->edgeIdsPos);
+        if (snapshot->csr.offsets[0] != 0 || snapshot->csr.offsets[header->numVertices] != 2 * header->numEdges) {
+            error = "corrupt snapshot offsets";
+        }
+    }
+
+    if (error != NULL) {
+        fprintf(stderr, "%s: %s\n", path, error);
+        unmapFile(&snapshot->file);
+        free(snapshot);
+        return NULL;
+    }
+    return snapshot;
+}
+
+static inline void closeSnapshot(GraphSnapshot* snapshot) {
+    unmapFile(&snapshot->file);
+    free(snapshot);
+}
+
+#endif
@@ -1,127 +1,437 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <time.h>
 
-typedef struct Edge {
-    int u;
-    int v;
-} Edge;
-
-typedef struct Graph {
-    int numVertices;
-    int numEdges;
-    Edge* edges;
-} Graph;
-
-Graph* createGraph(int numVertices, int maxEdges) {
-    Graph* graph = (Graph*)malloc(sizeof(Graph));
-    graph->numVertices = numVertices;
-    graph->numEdges = 0;
-    graph->edges = (Edge*)malloc(maxEdges * sizeof(Edge));
-    if (graph->edges == NULL) {
-        perror("Memory allocation failed");
-        exit(EXIT_FAILURE);
-    }
-    return graph;
+#include "graph.h"
+#include "kernelization.h"
+#include "graphLoader.h"
+#include "graphCSR.h"
+#include "graphSnapshot.h"
+#include "benchmark.h"
+#include "bipartite.h"
+#include "localRatio.h"
+#include "dynamicMatching.h"
+#include "parallelMatching.h"
+
+//edge is covered when atleast one vertex of the edge is in the cover
+bool isEdgeCovered(Edge edge, bool* vertexCover) {
+    return vertexCover[edge.u] || vertexCover[edge.v];
 }
 
-void addEdge(Graph* graph, int u, int v) {
-    if (u >= 0 && u < graph->numVertices && v >= 0 && v < graph->numVertices) {
-        graph->edges[graph->numEdges].u = u;
-        graph->edges[graph->numEdges].v = v;
-        graph->numEdges++;
-    } else {
-        printf("Invalid vertex indices: %d or %d\n", u, v);
+// add vertex to the cover and mark all of its incident edges as covered
+// in a single walk over its adjacency, returns the number of newly covered edges
+int64_t coverVertex(CSRGraph* csr, int vertex, bool* vertexCover, bool* coveredEdges) {
+    int64_t newlyCovered = 0;
+    vertexCover[vertex] = true;
+    for (int64_t i = csr->offsets[vertex]; i < csr->offsets[vertex + 1]; i++) {
+        int64_t edgeId = csr->edgeIds[i];
+        if (!coveredEdges[edgeId]) {
+            coveredEdges[edgeId] = true;
+            newlyCovered++;
+        }
     }
+    INSTR_COUNT(INSTR_EDGES_SCANNED, csr->offsets[vertex + 1] - csr->offsets[vertex]);
+    INSTR_COUNT(INSTR_COVER_UPDATES, newlyCovered);
+    return newlyCovered;
 }
 
-//edge is covered when atleast one vertex of the edge is in the cover
-bool isEdgeCovered(Edge edge, bool* vertexCover) {
-    return vertexCover[edge.u] || vertexCover[edge.v];
+// splitmix64, rand() only has 15 bits on some platforms,
+// too few to shuffle edge lists with millions of entries
+uint64_t randomState;
+
+uint64_t randomNext(void) {
+    uint64_t z = (randomState += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
 }
 
-bool* greedyVertexCover(Graph* graph) {
+// Maximal matching 2-approximation in O(V + E).
+// Edges are visited once in order (or in a random permutation when randomOrder is set);
+// an edge that is still uncovered joins the matching and both endpoints go into the cover.
+// Taking the first uncovered edge of a uniform random permutation is the same as picking
+// a uniform random uncovered edge, so this keeps the random tie-breaking of the original loop.
+bool* matchingVertexCover(Graph* graph, CSRGraph* csr, bool randomOrder) {
     int numVertices = graph->numVertices;
-    int numEdges = graph->numEdges;
+    int64_t numEdges = graph->numEdges;
     Edge* edges = graph->edges;
 
-    // Initialize the vertex cover array (true or false)
     bool* vertexCover = (bool*)calloc(numVertices, sizeof(bool));
-    if (vertexCover == NULL) {
+    bool* coveredEdges = (bool*)calloc(numEdges + 1, sizeof(bool));
+    int64_t* order = (int64_t*)malloc((numEdges + 1) * sizeof(int64_t));
+    if (vertexCover == NULL || coveredEdges == NULL || order == NULL) {
         perror("Memory allocation failed");
         exit(EXIT_FAILURE);
     }
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
 
-    int coveredEdges = 0;
+    for (int64_t i = 0; i < numEdges; i++) {
+        order[i] = i;
+    }
 
-    srand(time(NULL));
+    // Fisher-Yates shuffle of the edge order
+    if (randomOrder) {
+        for (int64_t i = numEdges - 1; i > 0; i--) {
+            int64_t j = (int64_t)(randomNext() % (uint64_t)(i + 1));
+            int64_t tmp = order[i];
+            order[i] = order[j];
+            order[j] = tmp;
+        }
+    }
 
-    while (coveredEdges < numEdges) {
-        int uncoveredEdgeIndex = -1;
-        int numUncoveredEdges = 0;
+    int64_t remainingEdges = numEdges;
+    int64_t i;
+    for (i = 0; i < numEdges && remainingEdges > 0; i++) {
+        int64_t edgeId = order[i];
+        if (coveredEdges[edgeId]) {
+            continue;
+        }
 
-        // count the number of uncovered edges
-        for (int i = 0; i < numEdges; i++) {
-            if (!isEdgeCovered(edges[i], vertexCover)) {
-                numUncoveredEdges++;
+        // neither endpoint is in the cover yet, so take both
+        remainingEdges -= coverVertex(csr, edges[edgeId].u, vertexCover, coveredEdges);
+        if (!vertexCover[edges[edgeId].v]) {
+            remainingEdges -= coverVertex(csr, edges[edgeId].v, vertexCover, coveredEdges);
+        }
+    }
 
-                //store first uncovered edge
-                //for when there is only one uncovered edge remaining
-                if (uncoveredEdgeIndex == -1) {
-                    uncoveredEdgeIndex = i;
-                }
-            }
+    INSTR_COUNT(INSTR_EDGES_SCANNED, i);
+    INSTR_PHASE_END(PHASE_SOLVE);
+
+    free(order);
+    free(coveredEdges);
+    return vertexCover;
+}
+
+bool* greedyVertexCover(Graph* graph) {
+    randomState = (uint64_t)time(NULL);
+
+    CSRGraph* csr = buildCSR(graph);
+    bool* vertexCover = matchingVertexCover(graph, csr, true);
+    freeCSR(csr);
+
+    return vertexCover;
+}
+
+// same as greedyVertexCover on a snapshot, whose CSR is already built
+bool* snapshotVertexCover(GraphSnapshot* snapshot) {
+    randomState = (uint64_t)time(NULL);
+
+    return matchingVertexCover(&snapshot->graph, &snapshot->csr, true);
+}
+
+// same matching cover found by deterministic reservation rounds on every core
+bool* parallelVertexCover(Graph* graph) {
+    return parallelMatchingCover(graph, 0, (uint64_t)time(NULL), NULL);
+}
+
+// Kernelize first, run the greedy cover on the kernel and lift it back
+bool* kernelizedVertexCover(Graph* graph) {
+    Kernel* kernel = kernelize(graph->numVertices, (const int*)graph->edges, graph->numEdges, -1);
+    Graph* reduced = createGraph(kernel->numVertices, kernel->numEdges);
+    addEdges(reduced, (const Edge*)kernel->endpoints, kernel->numEdges);
+
+    bool* kernelCover = greedyVertexCover(reduced);
+    bool* vertexCover = liftKernelCover(kernel, kernelCover);
+
+    free(kernelCover);
+    freeGraph(reduced);
+    freeKernel(kernel);
+    return vertexCover;
+}
+
+void printCover(const char* label, bool* vertexCover, int numVertices) {
+    int size = 0;
+    printf("%s: ", label);
+    for (int i = 0; i < numVertices; i++) {
+        if (vertexCover[i]) {
+            printf("%d ", i);
+            size++;
         }
+    }
+    printf("\n");
+    printf("Size: %d\n", size);
+}
+
+// parallel matching cover and the number of rounds it needed
+void printParallelCover(Graph* graph) {
+    int rounds;
+    bool* vertexCover = parallelMatchingCover(graph, 0, (uint64_t)time(NULL), &rounds);
+    printCover("Parallel Matching Cover", vertexCover, graph->numVertices);
+    printf("Rounds: %d\n", rounds);
+    free(vertexCover);
+}
 
-        // if no uncovered edges are left, we are done
-        if (numUncoveredEdges == 0) {
+// LP rounding, a 2-approximation that comes with a lower bound on the optimum
+void printLPCover(Graph* graph) {
+    int lowerBound;
+    bool* vertexCover = lpVertexCover(graph, &lowerBound);
+    printCover("LP Rounded Cover", vertexCover, graph->numVertices);
+    printf("LP lower bound: %d\n", lowerBound);
+    free(vertexCover);
+}
+
+// Local ratio cover for graphs with vertex costs, printed with its cost and
+// the lower bound the payments give
+void printLocalRatioCover(Graph* graph) {
+    int64_t lowerBound;
+    bool* vertexCover = localRatioVertexCover(graph, &lowerBound);
+    printCover("Local Ratio Cover", vertexCover, graph->numVertices);
+    printf("Cost: %lld (lower bound %lld)\n", (long long)coverWeight(graph, vertexCover), (long long)lowerBound);
+    free(vertexCover);
+}
+
+bool* benchLPCover(Graph* graph) {
+    return lpVertexCover(graph, NULL);
+}
+
+// --- streaming mode ---
+// The matching cover only ever asks "is this endpoint already covered?", so it
+// can run in one pass over an edge stream keeping nothing but a bit per vertex.
+
+#define STREAM_BLOCK_SIZE (1 << 20)
+
+typedef struct StreamCover {
+    uint64_t* bits;      // bit v is set when v is in the cover
+    int64_t words;       // allocated 64 bit words
+    int numVertices;     // highest vertex id seen + 1
+    int size;
+    int64_t numEdges;
+} StreamCover;
+
+bool streamCovered(StreamCover* cover, int v) {
+    return (cover->bits[v >> 6] >> (v & 63)) & 1;
+}
+
+void streamTake(StreamCover* cover, int v) {
+    cover->bits[v >> 6] |= (uint64_t)1 << (v & 63);
+    cover->size++;
+}
+
+// grow the bitmap so vertex v fits, vertex ids are not known up front
+void streamReserve(StreamCover* cover, int v) {
+    if (v >= cover->numVertices) {
+        cover->numVertices = v + 1;
+    }
+    int64_t needed = ((int64_t)v >> 6) + 1;
+    if (needed <= cover->words) return;
+    int64_t words = cover->words > 0 ? cover->words : 1024;
+    while (words < needed) {
+        words *= 2;
+    }
+    uint64_t* bits = (uint64_t*)realloc(cover->bits, words * sizeof(uint64_t));
+    if (bits == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    memset(bits + cover->words, 0, (words - cover->words) * sizeof(uint64_t));
+    cover->bits = bits;
+    cover->words = words;
+}
+
+// Parse whole "u v" lines from [p, end), returns false on a malformed line
+bool streamEdges(void* state, const char* p, const char* end, int64_t consumed, int64_t* errorAt) {
+    StreamCover* cover = (StreamCover*)state;
+    while (p < end) {
+        const char* line = p;
+        p = skipBlanks(p, end);
+        if (p == end || *p == '\n' || *p == '#' || *p == '%') {
+            p = skipLine(p, end);
+            consumed += p - line;
+            continue;
+        }
+        int64_t u, v;
+        p = scanNumber(p, end, &u);
+        if (p) p = scanNumber(p, end, &v);
+        if (!p || u < 0 || v < 0 || u > INT32_MAX - 1 || v > INT32_MAX - 1) {
+            *errorAt = consumed;
+            return false;
+        }
+        streamReserve(cover, u > v ? (int)u : (int)v);
+        // an edge with both endpoints uncovered joins the matching
+        if (!streamCovered(cover, (int)u) && !streamCovered(cover, (int)v)) {
+            streamTake(cover, (int)u);
+            if (u != v) streamTake(cover, (int)v);
+        }
+        cover->numEdges++;
+        p = skipLine(p, end);
+        consumed += p - line;
+    }
+    return true;
+}
+
+// Feeds a stream to parse in fixed size blocks of whole lines. A line cut by
+// the end of a block is carried over to the front of the next block.
+typedef bool (*StreamParser)(void* state, const char* p, const char* end, int64_t consumed, int64_t* errorAt);
+
+bool readStreamBlocks(FILE* in, const char* name, StreamParser parse, void* state) {
+    char* buffer = (char*)malloc(STREAM_BLOCK_SIZE);
+    if (buffer == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t carry = 0;
+    int64_t consumed = 0;
+    int64_t errorAt = -1;
+    bool done = false;
+    while (!done) {
+        size_t got = fread(buffer + carry, 1, STREAM_BLOCK_SIZE - carry, in);
+        size_t length = carry + got;
+        done = got < STREAM_BLOCK_SIZE - carry;
+        if (done && ferror(in)) {
+            perror(name);
+            errorAt = consumed;
             break;
         }
 
-        // select random index
-        // only when there are more than one uncovered edges
-        if (numUncoveredEdges > 1) {
-            int randomIndex = rand() % numUncoveredEdges;
-            int count = 0;
-
-            for(int i = 0; i < numEdges; i++){
-                if(!isEdgeCovered(edges[i], vertexCover)){
-                    if(count == randomIndex){
-                        uncoveredEdgeIndex = i;
-                        break;
-                    }
-                    count++;
-                }
+        // stop after the last complete line unless the stream has ended
+        size_t stop = length;
+        if (!done) {
+            while (stop > 0 && buffer[stop - 1] != '\n') stop--;
+            if (stop == 0) {
+                fprintf(stderr, "%s: line longer than %d bytes at byte %lld\n", name, STREAM_BLOCK_SIZE, (long long)consumed);
+                errorAt = consumed;
+                break;
             }
         }
+        if (!parse(state, buffer, buffer + stop, consumed, &errorAt)) {
+            fprintf(stderr, "%s: malformed line at byte %lld\n", name, (long long)errorAt);
+            break;
+        }
+        consumed += stop;
+        carry = length - stop;
+        memmove(buffer, buffer + stop, carry);
+    }
+    free(buffer);
+    return errorAt < 0;
+}
+
+// One pass over an edge list stream
+StreamCover* streamingVertexCover(FILE* in, const char* name) {
+    StreamCover* cover = (StreamCover*)calloc(1, sizeof(StreamCover));
+    if (cover == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    if (!readStreamBlocks(in, name, streamEdges, cover)) {
+        free(cover->bits);
+        free(cover);
+        return NULL;
+    }
+    return cover;
+}
+
+void printStreamCover(StreamCover* cover) {
+    printf("Streaming Vertex Cover: ");
+    for (int v = 0; v < cover->numVertices; v++) {
+        if (streamCovered(cover, v)) {
+            printf("%d ", v);
+        }
+    }
+    printf("\n");
+    printf("Size: %d\n", cover->size);
+}
 
-        // add both endpoints of the selected uncovered edge to the vertex cover
-        int bestU = edges[uncoveredEdgeIndex].u;
-        int bestV = edges[uncoveredEdgeIndex].v;
+void freeStreamCover(StreamCover* cover) {
+    free(cover->bits);
+    free(cover);
+}
 
-        if (!vertexCover[bestU]) {
-            vertexCover[bestU] = true;
+// --- dynamic mode ---
+// An update stream keeps a 2-approximate cover current as edges come and go:
+//   + u v    insert edge u-v ("u v" alone inserts as well)
+//   - u v    delete edge u-v
+//   ?        print the current cover size
+// Updates are applied in batches, only the batch application is timed.
+
+#define DYNAMIC_BATCH_SIZE (1 << 16)
+
+typedef struct DynamicStream {
+    DynamicMatching* matching;
+    EdgeUpdate* batch;
+    int64_t batched;
+    int64_t updates;
+    int64_t applied;
+    double seconds;
+} DynamicStream;
+
+void dynamicFlush(DynamicStream* stream) {
+    double start = benchNow();
+    stream->applied += dynamicApplyBatch(stream->matching, stream->batch, stream->batched);
+    stream->seconds += benchNow() - start;
+    stream->updates += stream->batched;
+    stream->batched = 0;
+}
+
+bool dynamicUpdates(void* state, const char* p, const char* end, int64_t consumed, int64_t* errorAt) {
+    DynamicStream* stream = (DynamicStream*)state;
+    while (p < end) {
+        const char* line = p;
+        p = skipBlanks(p, end);
+        if (p == end || *p == '\n' || *p == '#' || *p == '%') {
+            p = skipLine(p, end);
+            consumed += p - line;
+            continue;
         }
-        if (!vertexCover[bestV]) {
-            vertexCover[bestV] = true;
+        if (*p == '?') {
+            dynamicFlush(stream);
+            printf("After %lld updates: %lld edges, cover size %d\n", (long long)stream->updates,
+                   (long long)stream->matching->numEdges, dynamicCoverSize(stream->matching));
+            p = skipLine(p, end);
+            consumed += p - line;
+            continue;
         }
-
-        // recalculate the number of covered edges
-        coveredEdges = 0;
-        for (int i = 0; i < numEdges; i++) {
-            if (isEdgeCovered(edges[i], vertexCover)) {
-                coveredEdges++;
-            }
+        bool insert = *p != '-';
+        if (*p == '+' || *p == '-') p++;
+        int64_t u, v;
+        p = scanNumber(p, end, &u);
+        if (p) p = scanNumber(p, end, &v);
+        if (!p || u < 0 || v < 0 || u > INT32_MAX - 1 || v > INT32_MAX - 1) {
+            *errorAt = consumed;
+            return false;
+        }
+        stream->batch[stream->batched++] = (EdgeUpdate){(int)u, (int)v, insert};
+        if (stream->batched == DYNAMIC_BATCH_SIZE) {
+            dynamicFlush(stream);
         }
+        p = skipLine(p, end);
+        consumed += p - line;
     }
+    return true;
+}
 
-    return vertexCover;
+// Apply an update stream, returns the final matching or NULL on a read error
+DynamicMatching* dynamicVertexCover(FILE* in, const char* name, DynamicStream* stream) {
+    memset(stream, 0, sizeof(DynamicStream));
+    stream->matching = createDynamicMatching(0);
+    stream->batch = (EdgeUpdate*)malloc(DYNAMIC_BATCH_SIZE * sizeof(EdgeUpdate));
+    if (stream->batch == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    bool ok = readStreamBlocks(in, name, dynamicUpdates, stream);
+    if (ok) {
+        dynamicFlush(stream);
+    }
+    free(stream->batch);
+    if (!ok) {
+        freeDynamicMatching(stream->matching);
+        return NULL;
+    }
+    return stream->matching;
 }
 
-void freeGraph(Graph* graph) {
-    free(graph->edges);
-    free(graph);
+// every live edge has an endpoint in the snapshot
+bool dynamicCoverValid(const DynamicMatching* dm, const bool* cover) {
+    for (int v = 0; v < dm->numVertices; v++) {
+        for (int i = 0; i < dm->adjSize[v]; i++) {
+            if (!cover[v] && !cover[dm->adj[v][i]]) return false;
+        }
+        if (dm->loops[v] > 0 && !cover[v]) return false;
+    }
+    return true;
 }
 
 //test cases are some as the ones in bruteforce
@@ -141,18 +451,14 @@ void testGraph351() {
 
     printf("Running Greedy Algorithm for graph351...\n");
     bool* vertexCover = greedyVertexCover(graph);
-    int size = 0;
-    printf("Approximate Vertex Cover: ");
-    for (int i = 0; i < graph->numVertices; i++) {
-        if (vertexCover[i]) {
-            printf("%d ", i);
-            size++;
-        }
-    }
-    printf("\n");
-    printf("Size: %d\n", size);
-    freeGraph(graph);
+    printCover("Approximate Vertex Cover", vertexCover, graph->numVertices);
     free(vertexCover);
+
+    vertexCover = kernelizedVertexCover(graph);
+    printCover("Kernelized Vertex Cover", vertexCover, graph->numVertices);
+    free(vertexCover);
+    printLPCover(graph);
+    freeGraph(graph);
 }
 
 void testGraphConnected() {
@@ -166,18 +472,14 @@ void testGraphConnected() {
 
     printf("Running Greedy Algorithm for graphConnected...\n");
     bool* vertexCover = greedyVertexCover(graph);
-    int size = 0;
-    printf("Approximate Vertex Cover: ");
-    for (int i = 0; i < graph->numVertices; i++) {
-        if (vertexCover[i]) {
-            printf("%d ", i);
-            size++;
-        }
-    }
-    printf("\n");
-    printf("Size: %d\n", size);
-    freeGraph(graph);
+    printCover("Approximate Vertex Cover", vertexCover, graph->numVertices);
+    free(vertexCover);
+
+    vertexCover = kernelizedVertexCover(graph);
+    printCover("Kernelized Vertex Cover", vertexCover, graph->numVertices);
     free(vertexCover);
+    printLPCover(graph);
+    freeGraph(graph);
 }
 
 void testGraphBipartite() {
@@ -195,18 +497,21 @@ void testGraphBipartite() {
 
     printf("Running Greedy Algorithm for graphBipartite...\n");
     bool* vertexCover = greedyVertexCover(graph);
-    int size = 0;
-    printf("Approximate Vertex Cover: ");
-    for (int i = 0; i < graph->numVertices; i++) {
-        if (vertexCover[i]) {
-            printf("%d ", i);
-            size++;
-        }
+    printCover("Approximate Vertex Cover", vertexCover, graph->numVertices);
+    free(vertexCover);
+
+    vertexCover = kernelizedVertexCover(graph);
+    printCover("Kernelized Vertex Cover", vertexCover, graph->numVertices);
+    free(vertexCover);
+    printLPCover(graph);
+
+    // bipartite graphs get the exact cover as well
+    vertexCover = bipartiteVertexCover(graph);
+    if (vertexCover != NULL) {
+        printCover("Bipartite Exact Cover", vertexCover, graph->numVertices);
+        free(vertexCover);
     }
-    printf("\n");
-    printf("Size: %d\n", size);
     freeGraph(graph);
-    free(vertexCover);
 }
 
 void testGraphBig() {
@@ -348,18 +653,142 @@ void testGraphBig() {
 
     printf("Running Greedy Algorithm for graphBig...\n");
     bool* vertexCover = greedyVertexCover(graph);
-    int size = 0;
-    printf("Approximate Vertex Cover: ");
-    for (int i = 0; i < graph->numVertices; i++) {
-        if (vertexCover[i]) {
-            printf("%d ", i);
-            size++;
+    printCover("Approximate Vertex Cover", vertexCover, graph->numVertices);
+    free(vertexCover);
+    printParallelCover(graph);
+
+    vertexCover = kernelizedVertexCover(graph);
+    printCover("Kernelized Vertex Cover", vertexCover, graph->numVertices);
+    free(vertexCover);
+    printLPCover(graph);
+    freeGraph(graph);
+}
+
+// graph351 built edge by edge, then edges leave and a random stream churns a bigger graph
+void testGraphDynamic() {
+    DynamicMatching* dm = createDynamicMatching(7);
+    EdgeUpdate graph351[] = {
+        {0, 1, true}, {1, 2, true}, {2, 3, true}, {2, 4, true},
+        {3, 4, true}, {3, 5, true}, {3, 6, true}, {4, 5, true},
+    };
+    dynamicApplyBatch(dm, graph351, 8);
+    printf("Running Dynamic Matching for graphDynamic...\n");
+    bool* vertexCover = dynamicCoverSnapshot(dm);
+    printCover("Dynamic Vertex Cover", vertexCover, dm->numVertices);
+    free(vertexCover);
+
+    // drop every matched edge, the freed endpoints look for new mates
+    EdgeUpdate removals[] = {{0, 1, false}, {2, 3, false}, {4, 5, false}};
+    dynamicApplyBatch(dm, removals, 3);
+    vertexCover = dynamicCoverSnapshot(dm);
+    printf("Valid after deletions: %s\n", dynamicCoverValid(dm, vertexCover) ? "yes" : "no");
+    printCover("Dynamic Vertex Cover", vertexCover, dm->numVertices);
+    free(vertexCover);
+    freeDynamicMatching(dm);
+
+    // inserts and deletes of random live edges on 100000 vertices
+    int n = 100000;
+    int64_t numUpdates = 2000000;
+    EdgeUpdate* updates = (EdgeUpdate*)malloc(numUpdates * sizeof(EdgeUpdate));
+    Edge* live = (Edge*)malloc(numUpdates * sizeof(Edge));
+    if (updates == NULL || live == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    randomState = 142;
+    int64_t numLive = 0;
+    for (int64_t i = 0; i < numUpdates; i++) {
+        // grow to about 4n edges, then delete as often as insert
+        if (numLive > 0 && (numLive >= 4 * (int64_t)n || randomNext() % 3 == 0)) {
+            int64_t pick = (int64_t)(randomNext() % (uint64_t)numLive);
+            updates[i] = (EdgeUpdate){live[pick].u, live[pick].v, false};
+            live[pick] = live[--numLive];
+        } else {
+            int u = (int)(randomNext() % (uint64_t)n);
+            int v = (int)(randomNext() % (uint64_t)n);
+            updates[i] = (EdgeUpdate){u, v, true};
+            live[numLive++] = (Edge){u, v};
         }
     }
-    printf("\n");
-    printf("Size: %d\n", size);
+    dm = createDynamicMatching(n);
+    double start = benchNow();
+    int64_t applied = dynamicApplyBatch(dm, updates, numUpdates);
+    double elapsed = benchNow() - start;
+    vertexCover = dynamicCoverSnapshot(dm);
+    printf("Applied %lld of %lld updates in %.6f seconds (%.2f million per second)\n", (long long)applied,
+           (long long)numUpdates, elapsed, numUpdates / elapsed / 1e6);
+    printf("%lld edges left, cover size %d, valid: %s\n", (long long)dm->numEdges, dynamicCoverSize(dm),
+           dynamicCoverValid(dm, vertexCover) ? "yes" : "no");
+    free(vertexCover);
+    freeDynamicMatching(dm);
+    free(live);
+    free(updates);
+}
+
+// graph351 with a cost on every vertex, the same costs as in bruteforce_solution.c and vertexCoverDP.c
+void testGraphWeighted() {
+    static const int64_t costs[7] = {3, 1, 4, 2, 5, 1, 1};
+    Graph* graph = createGraph(7, 8);
+    addEdge(graph, 0, 1); // A-B
+    addEdge(graph, 1, 2); // B-C
+    addEdge(graph, 2, 3); // C-D
+    addEdge(graph, 2, 4); // C-E
+    addEdge(graph, 3, 4); // D-E
+    addEdge(graph, 3, 5); // D-F
+    addEdge(graph, 3, 6); // D-G
+    addEdge(graph, 4, 5); // E-F
+    for (int v = 0; v < 7; v++) {
+        setVertexWeight(graph, v, costs[v]);
+    }
+
+    printf("Running Local Ratio Algorithm for graphWeighted...\n");
+    printLocalRatioCover(graph);
     freeGraph(graph);
+}
+
+// graph given on the command line (edge list, DIMACS .col/.clq, METIS .graph or a snapshot)
+const char* graphFile = NULL;
+
+void testGraphFile() {
+    // snapshots are mapped as they are, text files are parsed into a Graph
+    GraphSnapshot* snapshot = NULL;
+    Graph* graph;
+    INSTR_PHASE_BEGIN(PHASE_LOAD);
+    if (isSnapshotFile(graphFile)) {
+        snapshot = openSnapshot(graphFile);
+        graph = snapshot ? &snapshot->graph : NULL;
+    } else {
+        graph = loadGraph(graphFile, FORMAT_AUTO);
+    }
+    INSTR_PHASE_END(PHASE_LOAD);
+    if (graph == NULL) {
+        exit(EXIT_FAILURE);
+    }
+    printf("Loaded %d vertices, %lld edges\n", graph->numVertices, (long long)graph->numEdges);
+    bool* vertexCover = snapshot ? snapshotVertexCover(snapshot) : greedyVertexCover(graph);
+    printCover("Approximate Vertex Cover", vertexCover, graph->numVertices);
+    free(vertexCover);
+    printParallelCover(graph);
+
+    vertexCover = kernelizedVertexCover(graph);
+    printCover("Kernelized Vertex Cover", vertexCover, graph->numVertices);
     free(vertexCover);
+    printLPCover(graph);
+    if (graph->weights) {
+        printLocalRatioCover(graph);
+    }
+
+    // bipartite graphs get the exact cover as well
+    vertexCover = snapshot ? bipartiteCSRCover(&snapshot->csr) : bipartiteVertexCover(graph);
+    if (vertexCover != NULL) {
+        printCover("Bipartite Exact Cover", vertexCover, graph->numVertices);
+        free(vertexCover);
+    }
+    if (snapshot) {
+        closeSnapshot(snapshot);
+    } else {
+        freeGraph(graph);
+    }
 }
 
 double timeTest(void (*testFunction)()) {
@@ -374,8 +803,79 @@ double timeTest(void (*testFunction)()) {
     return cpuTimeUsed;
 }
 
-int main() {
+BenchSolver benchSolvers[] = {
+    {"matching", greedyVertexCover, 0},
+    {"kernelized-matching", kernelizedVertexCover, 0},
+    {"lp-rounding", benchLPCover, 0},
+    {"bipartite-exact", bipartiteVertexCover, 0},
+    {"parallel-matching", parallelVertexCover, 0},
+};
+
+int main(int argc, char* argv[]) {
     double timeUsed;
+
+    // --stats <file> anywhere dumps the instrumentation counters at exit
+    instrumentStatsOption(&argc, argv, "greedy");
+
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        return runBenchmarks("greedy", benchSolvers, 5, argc - 2, argv + 2);
+    }
+
+    // --stream [file] covers an edge list in one pass, reading stdin without a file
+    if (argc > 1 && strcmp(argv[1], "--stream") == 0) {
+        FILE* in = argc > 2 ? fopen(argv[2], "rb") : stdin;
+        const char* name = argc > 2 ? argv[2] : "stdin";
+        if (in == NULL) {
+            perror(name);
+            return 1;
+        }
+        clock_t start = clock();
+        StreamCover* cover = streamingVertexCover(in, name);
+        if (in != stdin) {
+            fclose(in);
+        }
+        if (cover == NULL) {
+            return 1;
+        }
+        printStreamCover(cover);
+        printf("Streamed %lld edges over %d vertices in %.6f seconds\n", (long long)cover->numEdges,
+               cover->numVertices, ((double)(clock() - start)) / CLOCKS_PER_SEC);
+        freeStreamCover(cover);
+        return 0;
+    }
+
+    // --dynamic [file] keeps a cover current under an update stream, stdin without a file
+    if (argc > 1 && strcmp(argv[1], "--dynamic") == 0) {
+        FILE* in = argc > 2 ? fopen(argv[2], "rb") : stdin;
+        const char* name = argc > 2 ? argv[2] : "stdin";
+        if (in == NULL) {
+            perror(name);
+            return 1;
+        }
+        DynamicStream stream;
+        DynamicMatching* dm = dynamicVertexCover(in, name, &stream);
+        if (in != stdin) {
+            fclose(in);
+        }
+        if (dm == NULL) {
+            return 1;
+        }
+        bool* vertexCover = dynamicCoverSnapshot(dm);
+        printCover("Dynamic Vertex Cover", vertexCover, dm->numVertices);
+        free(vertexCover);
+        printf("Applied %lld of %lld updates in %.6f seconds, %lld edges left\n", (long long)stream.applied,
+               (long long)stream.updates, stream.seconds, (long long)dm->numEdges);
+        freeDynamicMatching(dm);
+        return 0;
+    }
+
+    if (argc > 1) {
+        graphFile = argv[1];
+        printf("Testing %s...\n", graphFile);
+        timeUsed = timeTest(testGraphFile);
+        printf("Time taken for %s: %.6f seconds\n", graphFile, timeUsed);
+        return 0;
+    }
     
     printf("Testing graph351...\n");
     timeUsed = timeTest(testGraph351);
@@ -391,7 +891,15 @@ int main() {
     
     printf("Testing graphBig\n");
     timeUsed = timeTest(testGraphBig);
-    printf("Time taken for graphBig: %.6f seconds\n", timeUsed);
+    printf("Time taken for graphBig: %.6f seconds\n\n", timeUsed);
+
+    printf("Testing graphWeighted...\n");
+    timeUsed = timeTest(testGraphWeighted);
+    printf("Time taken for graphWeighted: %.6f seconds\n\n", timeUsed);
+
+    printf("Testing graphDynamic...\n");
+    timeUsed = timeTest(testGraphDynamic);
+    printf("Time taken for graphDynamic: %.6f seconds\n", timeUsed);
 
     return 0;
 }
@@ -1,49 +1,151 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <time.h>
 
-typedef struct Edge {
-    int u;
-    int v;
-} Edge;
+#include "graph.h"
+#include "kernelization.h"
+#include "graphLoader.h"
+#include "graphCSR.h"
+#include "graphSnapshot.h"
+#include "benchmark.h"
+#include "bipartite.h"
 
-typedef struct Graph {
+//edge is covered when atleast one vertex of the edge is in the cover
+bool isEdgeCovered(Edge edge, bool* vertexCover) {
+    return vertexCover[edge.u] || vertexCover[edge.v];
+}
+
+// Bucket priority queue over residual degrees.
+// Every vertex sits in the doubly linked list of its current degree,
+// so a decrement is an unlink plus a push and finding the max only walks down,
+// since degrees never grow the max pointer moves at most maxDegree times in total.
+typedef struct BucketQueue {
     int numVertices;
-    int numEdges;
-    Edge* edges;
-} Graph;
-
-Graph* createGraph(int numVertices, int maxEdges) {
-    Graph* graph = (Graph*)malloc(sizeof(Graph));
-    graph->numVertices = numVertices;
-    graph->numEdges = 0;
-    graph->edges = (Edge*)malloc(maxEdges * sizeof(Edge));
-    if (graph->edges == NULL) {
+    int maxDegree;
+    int* degree;
+    int* head; // first vertex of each degree bucket, -1 when empty
+    int* next;
+    int* prev;
+} BucketQueue;
+
+void bucketPush(BucketQueue* queue, int vertex) {
+    int d = queue->degree[vertex];
+    queue->prev[vertex] = -1;
+    queue->next[vertex] = queue->head[d];
+    if (queue->head[d] != -1) {
+        queue->prev[queue->head[d]] = vertex;
+    }
+    queue->head[d] = vertex;
+}
+
+void bucketUnlink(BucketQueue* queue, int vertex) {
+    int d = queue->degree[vertex];
+    if (queue->prev[vertex] != -1) {
+        queue->next[queue->prev[vertex]] = queue->next[vertex];
+    } else {
+        queue->head[d] = queue->next[vertex];
+    }
+    if (queue->next[vertex] != -1) {
+        queue->prev[queue->next[vertex]] = queue->prev[vertex];
+    }
+}
+
+BucketQueue* createBucketQueue(CSRGraph* csr) {
+    int numVertices = csr->numVertices;
+    BucketQueue* queue = (BucketQueue*)malloc(sizeof(BucketQueue));
+    if (!queue) {
         perror("Memory allocation failed");
         exit(EXIT_FAILURE);
     }
-    return graph;
+    queue->numVertices = numVertices;
+    queue->maxDegree = 0;
+    queue->degree = (int*)malloc((numVertices + 1) * sizeof(int));
+    queue->next = (int*)malloc((numVertices + 1) * sizeof(int));
+    queue->prev = (int*)malloc((numVertices + 1) * sizeof(int));
+    if (!queue->degree || !queue->next || !queue->prev) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int v = 0; v < numVertices; v++) {
+        queue->degree[v] = (int)(csr->offsets[v + 1] - csr->offsets[v]);
+        if (queue->degree[v] > queue->maxDegree) {
+            queue->maxDegree = queue->degree[v];
+        }
+    }
+
+    queue->head = (int*)malloc((queue->maxDegree + 1) * sizeof(int));
+    if (!queue->head) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int d = 0; d <= queue->maxDegree; d++) {
+        queue->head[d] = -1;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        bucketPush(queue, v);
+    }
+    return queue;
 }
 
-void addEdge(Graph* graph, int u, int v) {
-    if (u >= 0 && u < graph->numVertices && v >= 0 && v < graph->numVertices) {
-        graph->edges[graph->numEdges].u = u;
-        graph->edges[graph->numEdges].v = v;
-        graph->numEdges++;
-    } else {
-        printf("Invalid vertex indices: %d or %d\n", u, v);
+void freeBucketQueue(BucketQueue* queue) {
+    free(queue->degree);
+    free(queue->head);
+    free(queue->next);
+    free(queue->prev);
+    free(queue);
+}
+
+// move a vertex one bucket down
+void bucketDecrement(BucketQueue* queue, int vertex) {
+    bucketUnlink(queue, vertex);
+    queue->degree[vertex]--;
+    bucketPush(queue, vertex);
+}
+
+// vertex with the highest residual degree, -1 when every degree is 0
+int bucketExtractMax(BucketQueue* queue) {
+    while (queue->maxDegree > 0 && queue->head[queue->maxDegree] == -1) {
+        queue->maxDegree--;
+    }
+    if (queue->maxDegree == 0) {
+        return -1;
     }
+    return queue->head[queue->maxDegree];
 }
 
-//edge is covered when atleast one vertex of the edge is in the cover
-bool isEdgeCovered(Edge edge, bool* vertexCover) {
-    return vertexCover[edge.u] || vertexCover[edge.v];
+// add vertex to the cover, mark its uncovered edges as covered and lower the
+// residual degree of the other endpoints, returns the number of newly covered edges
+int64_t coverVertex(CSRGraph* csr, BucketQueue* queue, int vertex, bool* vertexCover, bool* coveredEdges) {
+    int64_t newlyCovered = 0;
+    vertexCover[vertex] = true;
+    for (int64_t i = csr->offsets[vertex]; i < csr->offsets[vertex + 1]; i++) {
+        int64_t edgeId = csr->edgeIds[i];
+        if (!coveredEdges[edgeId]) {
+            coveredEdges[edgeId] = true;
+            newlyCovered++;
+            bucketDecrement(queue, csr->neighbors[i]);
+            bucketDecrement(queue, vertex);
+        }
+    }
+    INSTR_COUNT(INSTR_EDGES_SCANNED, csr->offsets[vertex + 1] - csr->offsets[vertex]);
+    INSTR_COUNT(INSTR_COVER_UPDATES, newlyCovered);
+    return newlyCovered;
 }
 
-bool* greedyVertexCover(Graph* graph) {
+typedef enum GreedyStrategy {
+    FIRST_EDGE_ENDPOINT, // take the higher degree endpoint of the first uncovered edge
+    MAX_DEGREE           // take the vertex with the highest residual degree
+} GreedyStrategy;
+
+// Both strategies run in O(V + E): the first edge pointer only moves forward,
+// residual degrees are read from the bucket queue and covering a vertex is one adjacency walk.
+// csr must be the CSR of graph, built by buildCSR or mapped from a snapshot
+bool* csrVertexCover(Graph* graph, CSRGraph* csr, GreedyStrategy strategy) {
     int numVertices = graph->numVertices;
-    int numEdges = graph->numEdges;
+    int64_t numEdges = graph->numEdges;
     Edge* edges = graph->edges;
 
     bool* vertexCover = (bool*)calloc(numVertices, sizeof(bool));
@@ -52,68 +154,474 @@ bool* greedyVertexCover(Graph* graph) {
         exit(EXIT_FAILURE);
     }
 
-    bool* coveredEdges = (bool*)calloc(numEdges, sizeof(bool));
+    bool* coveredEdges = (bool*)calloc(numEdges + 1, sizeof(bool));
     if (!coveredEdges) {
         perror("Memory allocation failed");
         free(vertexCover);
         exit(EXIT_FAILURE);
     }
 
-    int remainingEdges = numEdges;
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
+    BucketQueue* queue = createBucketQueue(csr);
+    int64_t remainingEdges = numEdges;
+    int64_t edgeIndex = 0;
 
     srand(time(NULL));
 
     while (remainingEdges > 0) {
-        // Find the first uncovered edge
-        int edgeIndex = -1;
-        for (int i = 0; i < numEdges; i++) {
-            if (!coveredEdges[i]) {
-                edgeIndex = i;
-                break;
+        int selected;
+        if (strategy == MAX_DEGREE) {
+            selected = bucketExtractMax(queue);
+            if (selected == -1) break; // All edges covered
+        } else {
+            // Find the first uncovered edge, earlier edges stay covered
+            while (edgeIndex < numEdges && coveredEdges[edgeIndex]) {
+                edgeIndex++;
             }
-        }
-        if (edgeIndex == -1) break; // All edges covered
-
-        Edge edge = edges[edgeIndex];
-        int u = edge.u;
-        int v = edge.v;
-
-        // Choose the vertex with higher degree (or any other heuristic)
-        int degreeU = 0, degreeV = 0;
-        for (int i = 0; i < numEdges; i++) {
-            if (!coveredEdges[i]) {
-                if (edges[i].u == u || edges[i].v == u) degreeU++;
-                if (edges[i].u == v || edges[i].v == v) degreeV++;
+            if (edgeIndex == numEdges) break; // All edges covered
+
+            int u = edges[edgeIndex].u;
+            int v = edges[edgeIndex].v;
+            int degreeU = queue->degree[u];
+            int degreeV = queue->degree[v];
+
+            // Add the vertex that covers more uncovered edges
+            if (degreeU == degreeV){
+                //degrees are euqal, select one of the two vertices
+                selected=(rand()%2)? u : v;
+            }else{
+                //otherwise select the vertez with higher degree
+                selected=(degreeU >degreeV)? u:v;
             }
         }
 
-        // Add the vertex that covers more uncovered edges
-        int selected;
-        if (degreeU == degreeV){
-            //degrees are euqal, select one of the two vertices
-            selected=(rand()%2)? u : v;
-        }else{
-            //otherwise select the vertez with higher degree
-            selected=(degreeU >degreeV)? u:v;
+        remainingEdges -= coverVertex(csr, queue, selected, vertexCover, coveredEdges);
+    }
+
+    freeBucketQueue(queue);
+    free(coveredEdges);
+    INSTR_PHASE_END(PHASE_SOLVE);
+    return vertexCover;
+}
+
+bool* greedyVertexCover(Graph* graph, GreedyStrategy strategy) {
+    CSRGraph* csr = buildCSR(graph);
+    bool* vertexCover = csrVertexCover(graph, csr, strategy);
+    freeCSR(csr);
+    return vertexCover;
+}
+
+// --- local search ---
+// NuMVC style improvement of a greedy cover. While the cover C is complete it
+// is recorded and its worst vertex dropped, otherwise one vertex leaves C and
+// one endpoint of a random uncovered edge enters it. Every step each
+// uncovered edge gains one unit of weight, and dscore[v] is the change in
+// uncovered weight if v flipped in or out of C.
+//
+// Weight growth is applied lazily so a step never walks the uncovered edges:
+// an uncovered edge remembers the clock value at which it became uncovered,
+// and a vertex outside C remembers how many uncovered edges touch it and
+// when its dscore was last brought up to date. A flip therefore costs the
+// degree of the flipped vertex. The vertex to drop is the best of a few
+// random samples of C (FastVC's BMS) instead of a scan of the whole cover.
+
+#define LOCAL_SEARCH_SAMPLES 50      // BMS sample size
+#define WEIGHT_FORGET_RATIO 0.3      // weights shrink to this fraction...
+#define WEIGHT_FORGET_MEAN 0.5       // ...once their mean exceeds this times numVertices
+
+typedef struct LocalSearch {
+    Graph* graph;
+    CSRGraph* csr;
+    bool* inCover;
+    bool* locked;           // vertices with a self loop never leave the cover
+    bool* confChange;       // configuration checking: v may enter only if a neighbor changed since v left
+    int64_t* dscore;        // as of settled[v]
+    int64_t* settled;
+    int* uncoveredDegree;   // uncovered edges at v, each adds 1 to dscore[v] per clock tick
+    int64_t* age;           // step of the last flip, older vertices win ties
+    int64_t* weight;        // as of since[e] for uncovered edges
+    int64_t* since;
+    int* coverList;         // unlocked vertices of C, for sampling
+    int* coverPos;
+    int coverListSize;
+    int coverSize;
+    int64_t* uncovered;     // uncovered edges and their positions, for O(1) random choice
+    int64_t* uncoveredPos;
+    int64_t numUncovered;
+    int64_t clock;          // weight increments so far
+    int64_t totalWeight;
+    uint64_t rng;
+} LocalSearch;
+
+typedef struct LocalSearchStats {
+    int64_t iterations;
+    double seconds;
+    double bestSeconds;     // when the returned cover was found
+    int startSize;
+    int bestSize;
+} LocalSearchStats;
+
+uint64_t localSearchRandom(LocalSearch* ls) {
+    uint64_t z = (ls->rng += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// bring dscore[v] up to the current clock
+void localSearchSettle(LocalSearch* ls, int v) {
+    ls->dscore[v] += ls->uncoveredDegree[v] * (ls->clock - ls->settled[v]);
+    ls->settled[v] = ls->clock;
+}
+
+int64_t localSearchScore(LocalSearch* ls, int v) {
+    return ls->dscore[v] + ls->uncoveredDegree[v] * (ls->clock - ls->settled[v]);
+}
+
+void uncoveredPush(LocalSearch* ls, int64_t edge) {
+    ls->since[edge] = ls->clock;
+    ls->uncoveredPos[edge] = ls->numUncovered;
+    ls->uncovered[ls->numUncovered++] = edge;
+}
+
+// remove edge from the uncovered set and fold its lazy growth into weight[edge]
+void uncoveredRemove(LocalSearch* ls, int64_t edge) {
+    ls->weight[edge] += ls->clock - ls->since[edge];
+    int64_t last = ls->uncovered[--ls->numUncovered];
+    ls->uncovered[ls->uncoveredPos[edge]] = last;
+    ls->uncoveredPos[last] = ls->uncoveredPos[edge];
+}
+
+void localSearchAdd(LocalSearch* ls, int v, int64_t step) {
+    CSRGraph* csr = ls->csr;
+    localSearchSettle(ls, v);
+    ls->inCover[v] = true;
+    ls->dscore[v] = -ls->dscore[v];
+    ls->uncoveredDegree[v] = 0;
+    ls->age[v] = step;
+    ls->coverSize++;
+    ls->coverPos[v] = ls->coverListSize;
+    ls->coverList[ls->coverListSize++] = v;
+    for (int64_t i = csr->offsets[v]; i < csr->offsets[v + 1]; i++) {
+        int u = csr->neighbors[i];
+        int64_t edge = csr->edgeIds[i];
+        if (u == v) continue;
+        localSearchSettle(ls, u);
+        if (ls->inCover[u]) {
+            ls->dscore[u] += ls->weight[edge];  // u no longer covers it alone
+        } else {
+            uncoveredRemove(ls, edge);
+            ls->dscore[u] -= ls->weight[edge];
+            ls->uncoveredDegree[u]--;
+            INSTR_COUNT(INSTR_COVER_UPDATES, 1);
         }
-        vertexCover[selected] = true;
+        ls->confChange[u] = true;
+    }
+    INSTR_COUNT(INSTR_EDGES_SCANNED, csr->offsets[v + 1] - csr->offsets[v]);
+}
 
-        // Mark all edges covered by 'selected' as covered
-        for (int i = 0; i < numEdges; i++) {
-            if (!coveredEdges[i] && (edges[i].u == selected || edges[i].v == selected)) {
-                coveredEdges[i] = true;
-                remainingEdges--;
+void localSearchRemove(LocalSearch* ls, int v, int64_t step) {
+    CSRGraph* csr = ls->csr;
+    localSearchSettle(ls, v);
+    ls->inCover[v] = false;
+    ls->dscore[v] = -ls->dscore[v];
+    ls->age[v] = step;
+    ls->confChange[v] = false;
+    ls->coverSize--;
+    int last = ls->coverList[--ls->coverListSize];
+    ls->coverList[ls->coverPos[v]] = last;
+    ls->coverPos[last] = ls->coverPos[v];
+    for (int64_t i = csr->offsets[v]; i < csr->offsets[v + 1]; i++) {
+        int u = csr->neighbors[i];
+        int64_t edge = csr->edgeIds[i];
+        if (u == v) continue;
+        localSearchSettle(ls, u);
+        if (ls->inCover[u]) {
+            ls->dscore[u] -= ls->weight[edge];  // u now covers it alone
+        } else {
+            uncoveredPush(ls, edge);
+            ls->dscore[u] += ls->weight[edge];
+            ls->uncoveredDegree[u]++;
+            ls->uncoveredDegree[v]++;
+            INSTR_COUNT(INSTR_COVER_UPDATES, 1);
+        }
+        ls->confChange[u] = true;
+    }
+    INSTR_COUNT(INSTR_EDGES_SCANNED, csr->offsets[v + 1] - csr->offsets[v]);
+}
+
+// higher dscore wins, then the vertex that has not moved for longer
+bool localSearchBetter(LocalSearch* ls, int u, int v) {
+    int64_t scoreU = localSearchScore(ls, u);
+    int64_t scoreV = localSearchScore(ls, v);
+    return scoreU > scoreV || (scoreU == scoreV && ls->age[u] < ls->age[v]);
+}
+
+// best of LOCAL_SEARCH_SAMPLES random removable cover vertices, skipping tabu
+int localSearchPickRemoval(LocalSearch* ls, int tabu) {
+    int best = -1;
+    if (ls->coverListSize <= LOCAL_SEARCH_SAMPLES) {
+        for (int i = 0; i < ls->coverListSize; i++) {
+            int v = ls->coverList[i];
+            if (v != tabu && (best < 0 || localSearchBetter(ls, v, best))) best = v;
+        }
+    } else {
+        for (int i = 0; i < LOCAL_SEARCH_SAMPLES; i++) {
+            int v = ls->coverList[localSearchRandom(ls) % (uint64_t)ls->coverListSize];
+            if (v != tabu && (best < 0 || localSearchBetter(ls, v, best))) best = v;
+        }
+    }
+    return best;
+}
+
+// Fold all lazy growth into the weights, optionally scale them down, and
+// recompute every dscore from scratch
+void localSearchReweigh(LocalSearch* ls, double scale) {
+    Graph* graph = ls->graph;
+    for (int64_t i = 0; i < ls->numUncovered; i++) {
+        int64_t edge = ls->uncovered[i];
+        ls->weight[edge] += ls->clock - ls->since[edge];
+        ls->since[edge] = ls->clock;
+    }
+    ls->totalWeight = 0;
+    for (int64_t e = 0; e < graph->numEdges; e++) {
+        if (scale < 1) {
+            ls->weight[e] = (int64_t)(ls->weight[e] * scale);
+            if (ls->weight[e] < 1) ls->weight[e] = 1;
+        }
+        ls->totalWeight += ls->weight[e];
+    }
+    for (int v = 0; v < graph->numVertices; v++) {
+        ls->dscore[v] = 0;
+        ls->settled[v] = ls->clock;
+    }
+    for (int64_t e = 0; e < graph->numEdges; e++) {
+        int u = graph->edges[e].u;
+        int v = graph->edges[e].v;
+        if (u == v) continue;
+        if (ls->inCover[u] && !ls->inCover[v]) {
+            ls->dscore[u] -= ls->weight[e];
+        } else if (ls->inCover[v] && !ls->inCover[u]) {
+            ls->dscore[v] -= ls->weight[e];
+        } else if (!ls->inCover[u] && !ls->inCover[v]) {
+            ls->dscore[u] += ls->weight[e];
+            ls->dscore[v] += ls->weight[e];
+        }
+    }
+}
+
+// Improve the MAX_DEGREE greedy cover until maxSeconds of wall time or
+// maxIterations steps have passed (a value <= 0 disables that budget).
+// csr must be the CSR of graph. Returns the smallest cover found.
+bool* localSearchVertexCover(Graph* graph, CSRGraph* csr, double maxSeconds, int64_t maxIterations,
+                             uint64_t seed, LocalSearchStats* stats) {
+    double start = benchNow();
+    int n = graph->numVertices;
+    int64_t m = graph->numEdges;
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
+
+    LocalSearch ls;
+    ls.graph = graph;
+    ls.csr = csr;
+    ls.inCover = (bool*)calloc(n + 1, sizeof(bool));
+    ls.locked = (bool*)calloc(n + 1, sizeof(bool));
+    ls.confChange = (bool*)malloc((n + 1) * sizeof(bool));
+    ls.dscore = (int64_t*)calloc(n + 1, sizeof(int64_t));
+    ls.settled = (int64_t*)calloc(n + 1, sizeof(int64_t));
+    ls.uncoveredDegree = (int*)calloc(n + 1, sizeof(int));
+    ls.age = (int64_t*)calloc(n + 1, sizeof(int64_t));
+    ls.weight = (int64_t*)malloc((m + 1) * sizeof(int64_t));
+    ls.since = (int64_t*)malloc((m + 1) * sizeof(int64_t));
+    ls.coverList = (int*)malloc((n + 1) * sizeof(int));
+    ls.coverPos = (int*)malloc((n + 1) * sizeof(int));
+    ls.uncovered = (int64_t*)malloc((m + 1) * sizeof(int64_t));
+    ls.uncoveredPos = (int64_t*)malloc((m + 1) * sizeof(int64_t));
+    if (!ls.inCover || !ls.locked || !ls.confChange || !ls.dscore || !ls.settled || !ls.uncoveredDegree ||
+        !ls.age || !ls.weight || !ls.since || !ls.coverList || !ls.coverPos || !ls.uncovered || !ls.uncoveredPos) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    ls.coverListSize = 0;
+    ls.coverSize = 0;
+    ls.numUncovered = 0;
+    ls.clock = 0;
+    ls.rng = seed;
+
+    // start from the greedy cover with all weights at 1
+    bool* best = csrVertexCover(graph, csr, MAX_DEGREE);
+    for (int64_t e = 0; e < m; e++) {
+        ls.weight[e] = 1;
+        if (graph->edges[e].u == graph->edges[e].v) ls.locked[graph->edges[e].u] = true;
+    }
+    for (int v = 0; v < n; v++) {
+        ls.confChange[v] = true;
+        if (best[v]) {
+            ls.inCover[v] = true;
+            ls.coverSize++;
+            if (!ls.locked[v]) {
+                ls.coverPos[v] = ls.coverListSize;
+                ls.coverList[ls.coverListSize++] = v;
+            }
+        }
+    }
+    localSearchReweigh(&ls, 1);
+
+    int bestSize = ls.coverSize;
+    stats->startSize = bestSize;
+    stats->bestSeconds = benchNow() - start;
+    int64_t forgetLimit = (int64_t)(WEIGHT_FORGET_MEAN * n) * m;
+    int tabu = -1;
+    int64_t step = 0;
+    while (maxIterations <= 0 || step < maxIterations) {
+        // the clock is read every 256 steps
+        if (maxSeconds > 0 && (step & 255) == 0 && benchNow() - start >= maxSeconds) break;
+        step++;
+
+        if (ls.numUncovered == 0) {
+            INSTR_COUNT(INSTR_LEAVES, 1);
+            if (ls.coverSize < bestSize) {
+                bestSize = ls.coverSize;
+                memcpy(best, ls.inCover, n * sizeof(bool));
+                stats->bestSeconds = benchNow() - start;
             }
+            int v = localSearchPickRemoval(&ls, -1);
+            if (v < 0) break;  // nothing left to remove
+            localSearchRemove(&ls, v, step);
+            continue;
+        }
+
+        int u = localSearchPickRemoval(&ls, tabu);
+        if (u >= 0) localSearchRemove(&ls, u, step);
+
+        // one endpoint of a random uncovered edge enters, its configuration must have changed
+        Edge edge = graph->edges[ls.uncovered[localSearchRandom(&ls) % (uint64_t)ls.numUncovered]];
+        int v;
+        if (!ls.confChange[edge.u]) {
+            v = edge.v;
+        } else if (!ls.confChange[edge.v]) {
+            v = edge.u;
+        } else {
+            v = localSearchBetter(&ls, edge.u, edge.v) ? edge.u : edge.v;
+        }
+        localSearchAdd(&ls, v, step);
+        tabu = v;
+
+        // edges still uncovered get heavier, one clock tick does it for all of them
+        ls.clock++;
+        ls.totalWeight += ls.numUncovered;
+        if (ls.totalWeight > forgetLimit) {
+            localSearchReweigh(&ls, WEIGHT_FORGET_RATIO);
         }
     }
+    if (ls.numUncovered == 0 && ls.coverSize < bestSize) {
+        bestSize = ls.coverSize;
+        memcpy(best, ls.inCover, n * sizeof(bool));
+        stats->bestSeconds = benchNow() - start;
+    }
 
-    free(coveredEdges);
+    stats->iterations = step;
+    stats->seconds = benchNow() - start;
+    stats->bestSize = bestSize;
+    INSTR_COUNT(INSTR_NODES, step);
+
+    free(ls.inCover);
+    free(ls.locked);
+    free(ls.confChange);
+    free(ls.dscore);
+    free(ls.settled);
+    free(ls.uncoveredDegree);
+    free(ls.age);
+    free(ls.weight);
+    free(ls.since);
+    free(ls.coverList);
+    free(ls.coverPos);
+    free(ls.uncovered);
+    free(ls.uncoveredPos);
+    INSTR_PHASE_END(PHASE_SOLVE);
+    return best;
+}
+
+// Kernelize first, run the chosen strategy on the kernel and lift it back
+bool* kernelizedVertexCover(Graph* graph, GreedyStrategy strategy) {
+    Kernel* kernel = kernelize(graph->numVertices, (const int*)graph->edges, graph->numEdges, -1);
+    Graph* reduced = createGraph(kernel->numVertices, kernel->numEdges);
+    addEdges(reduced, (const Edge*)kernel->endpoints, kernel->numEdges);
+
+    bool* kernelCover = greedyVertexCover(reduced, strategy);
+    bool* vertexCover = liftKernelCover(kernel, kernelCover);
+
+    free(kernelCover);
+    freeGraph(reduced);
+    freeKernel(kernel);
     return vertexCover;
 }
 
-void freeGraph(Graph* graph) {
-    free(graph->edges);
-    free(graph);
+// run one strategy on the graph (or on its kernel) and print the resulting cover,
+// csr is a prebuilt CSR of graph or NULL to build one
+void runGreedy(Graph* graph, CSRGraph* csr, GreedyStrategy strategy, bool kernelized) {
+    bool* vertexCover;
+    if (kernelized) {
+        vertexCover = kernelizedVertexCover(graph, strategy);
+    } else if (csr != NULL) {
+        vertexCover = csrVertexCover(graph, csr, strategy);
+    } else {
+        vertexCover = greedyVertexCover(graph, strategy);
+    }
+    int size = 0;
+    printf("%s%s: ", kernelized ? "Kernelized " : "", strategy == MAX_DEGREE ? "Max Degree Cover" : "First Edge Cover");
+    for (int i = 0; i < graph->numVertices; i++) {
+        if (vertexCover[i]) {
+            printf("%d ", i);
+            size++;
+        }
+    }
+    printf("\n");
+    printf("Size: %d\n", size);
+    free(vertexCover);
+}
+
+// print the exact Konig cover when the graph is bipartite, returns false otherwise.
+// csr is the snapshot CSR of graph, or NULL to build one
+bool runBipartite(Graph* graph, const CSRGraph* csr) {
+    bool* vertexCover = csr ? bipartiteCSRCover(csr) : bipartiteVertexCover(graph);
+    if (vertexCover == NULL) {
+        return false;
+    }
+    int size = 0;
+    printf("Bipartite Exact Cover: ");
+    for (int i = 0; i < graph->numVertices; i++) {
+        if (vertexCover[i]) {
+            printf("%d ", i);
+            size++;
+        }
+    }
+    printf("\n");
+    printf("Size: %d\n", size);
+    free(vertexCover);
+    return true;
+}
+
+// local search budget, set with --seconds and --iterations (<= 0 disables one)
+double searchSeconds = 0;
+int64_t searchIterations = 100000;
+
+// run the local search from the greedy cover and print the best cover found
+void runLocalSearch(Graph* graph, CSRGraph* csr) {
+    CSRGraph* built = csr ? NULL : buildCSR(graph);
+    LocalSearchStats stats;
+    bool* vertexCover = localSearchVertexCover(graph, csr ? csr : built, searchSeconds, searchIterations,
+                                               (uint64_t)time(NULL), &stats);
+    printf("Local Search Cover: ");
+    for (int i = 0; i < graph->numVertices; i++) {
+        if (vertexCover[i]) {
+            printf("%d ", i);
+        }
+    }
+    printf("\n");
+    printf("Size: %d (greedy %d, %lld iterations in %.3f s, best after %.3f s)\n", stats.bestSize,
+           stats.startSize, (long long)stats.iterations, stats.seconds, stats.bestSeconds);
+    free(vertexCover);
+    if (built) freeCSR(built);
 }
 
 //test cases are some as the ones in bruteforce
@@ -132,19 +640,11 @@ void testGraph351() {
     addEdge(graph, 4, 5); // E-F
 
     printf("Running Greedy Algorithm for graph351...\n");
-    bool* vertexCover = greedyVertexCover(graph);
-    int size = 0;
-    printf("Approximate Vertex Cover: ");
-    for (int i = 0; i < graph->numVertices; i++) {
-        if (vertexCover[i]) {
-            printf("%d ", i);
-            size++;
-        }
-    }
-    printf("\n");
-    printf("Size: %d\n", size);
+    runGreedy(graph, NULL, FIRST_EDGE_ENDPOINT, false);
+    runGreedy(graph, NULL, MAX_DEGREE, false);
+    runGreedy(graph, NULL, MAX_DEGREE, true);
+    runLocalSearch(graph, NULL);
     freeGraph(graph);
-    free(vertexCover);
 }
 
 void testGraphConnected() {
@@ -157,19 +657,11 @@ void testGraphConnected() {
     }
 
     printf("Running Greedy Algorithm for graphConnected...\n");
-    bool* vertexCover = greedyVertexCover(graph);
-    int size = 0;
-    printf("Approximate Vertex Cover: ");
-    for (int i = 0; i < graph->numVertices; i++) {
-        if (vertexCover[i]) {
-            printf("%d ", i);
-            size++;
-        }
-    }
-    printf("\n");
-    printf("Size: %d\n", size);
+    runGreedy(graph, NULL, FIRST_EDGE_ENDPOINT, false);
+    runGreedy(graph, NULL, MAX_DEGREE, false);
+    runGreedy(graph, NULL, MAX_DEGREE, true);
+    runLocalSearch(graph, NULL);
     freeGraph(graph);
-    free(vertexCover);
 }
 
 void testGraphBipartite() {
@@ -186,19 +678,12 @@ void testGraphBipartite() {
     addEdge(graph, 4, 9); // E-J
 
     printf("Running Greedy Algorithm for graphBipartite...\n");
-    bool* vertexCover = greedyVertexCover(graph);
-    int size = 0;
-    printf("Approximate Vertex Cover: ");
-    for (int i = 0; i < graph->numVertices; i++) {
-        if (vertexCover[i]) {
-            printf("%d ", i);
-            size++;
-        }
-    }
-    printf("\n");
-    printf("Size: %d\n", size);
+    runGreedy(graph, NULL, FIRST_EDGE_ENDPOINT, false);
+    runGreedy(graph, NULL, MAX_DEGREE, false);
+    runGreedy(graph, NULL, MAX_DEGREE, true);
+    runBipartite(graph, NULL);
+    runLocalSearch(graph, NULL);
     freeGraph(graph);
-    free(vertexCover);
 }
 
 void testGraphBig() {
@@ -339,19 +824,45 @@ void testGraphBig() {
     addEdge(graph, 20, 17); // U-R
 
     printf("Running Greedy Algorithm for graphBig...\n");
-    bool* vertexCover = greedyVertexCover(graph);
-    int size = 0;
-    printf("Approximate Vertex Cover: ");
-    for (int i = 0; i < graph->numVertices; i++) {
-        if (vertexCover[i]) {
-            printf("%d ", i);
-            size++;
-        }
-    }
-    printf("\n");
-    printf("Size: %d\n", size);
+    runGreedy(graph, NULL, FIRST_EDGE_ENDPOINT, false);
+    runGreedy(graph, NULL, MAX_DEGREE, false);
+    runGreedy(graph, NULL, MAX_DEGREE, true);
+    runLocalSearch(graph, NULL);
     freeGraph(graph);
-    free(vertexCover);
+}
+
+// graph given on the command line (edge list, DIMACS .col/.clq, METIS .graph or a snapshot)
+const char* graphFile = NULL;
+
+void testGraphFile() {
+    // snapshots are mapped as they are, text files are parsed into a Graph
+    GraphSnapshot* snapshot = NULL;
+    Graph* graph;
+    INSTR_PHASE_BEGIN(PHASE_LOAD);
+    if (isSnapshotFile(graphFile)) {
+        snapshot = openSnapshot(graphFile);
+        graph = snapshot ? &snapshot->graph : NULL;
+    } else {
+        graph = loadGraph(graphFile, FORMAT_AUTO);
+    }
+    INSTR_PHASE_END(PHASE_LOAD);
+    if (graph == NULL) {
+        exit(EXIT_FAILURE);
+    }
+    printf("Loaded %d vertices, %lld edges\n", graph->numVertices, (long long)graph->numEdges);
+    CSRGraph* csr = snapshot ? &snapshot->csr : NULL;
+    runGreedy(graph, csr, FIRST_EDGE_ENDPOINT, false);
+    runGreedy(graph, csr, MAX_DEGREE, false);
+    runGreedy(graph, csr, MAX_DEGREE, true);
+    // the exact cover leaves nothing for the local search to improve
+    if (!runBipartite(graph, csr)) {
+        runLocalSearch(graph, csr);
+    }
+    if (snapshot) {
+        closeSnapshot(snapshot);
+    } else {
+        freeGraph(graph);
+    }
 }
 
 double timeTest(void (*testFunction)()) {
@@ -366,8 +877,60 @@ double timeTest(void (*testFunction)()) {
     return cpuTimeUsed;
 }
 
-int main() {
+bool* firstEdgeCover(Graph* graph) {
+    return greedyVertexCover(graph, FIRST_EDGE_ENDPOINT);
+}
+
+bool* maxDegreeCover(Graph* graph) {
+    return greedyVertexCover(graph, MAX_DEGREE);
+}
+
+bool* kernelizedMaxDegreeCover(Graph* graph) {
+    return kernelizedVertexCover(graph, MAX_DEGREE);
+}
+
+bool* localSearchCover(Graph* graph) {
+    CSRGraph* csr = buildCSR(graph);
+    LocalSearchStats stats;
+    bool* vertexCover = localSearchVertexCover(graph, csr, searchSeconds, searchIterations, 142, &stats);
+    freeCSR(csr);
+    return vertexCover;
+}
+
+BenchSolver benchSolvers[] = {
+    {"first-edge", firstEdgeCover, 0},
+    {"max-degree", maxDegreeCover, 0},
+    {"kernelized-max-degree", kernelizedMaxDegreeCover, 0},
+    {"local-search", localSearchCover, 0},
+    {"bipartite-exact", bipartiteVertexCover, 0},
+};
+
+int main(int argc, char* argv[]) {
     double timeUsed;
+
+    // --seconds <s> and --iterations <n> set the local search budget,
+    // --bench runs the benchmark matrix with the options that follow it,
+    // a file argument runs that graph instead of the built-in tests,
+    // --stats <file> dumps the instrumentation counters at exit
+    instrumentStatsOption(&argc, argv, "greedyV2");
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bench") == 0) {
+            return runBenchmarks("greedyV2", benchSolvers, 5, argc - i - 1, argv + i + 1);
+        } else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            searchSeconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            searchIterations = strtoll(argv[++i], NULL, 10);
+        } else {
+            graphFile = argv[i];
+        }
+    }
+
+    if (graphFile != NULL) {
+        printf("Testing %s...\n", graphFile);
+        timeUsed = timeTest(testGraphFile);
+        printf("Time taken for %s: %.6f seconds\n", graphFile, timeUsed);
+        return 0;
+    }
     
     printf("Testing graph351...\n");
     timeUsed = timeTest(testGraph351);
@@ -0,0 +1,400 @@
+// Solver instrumentation, compiled in with -DVC_INSTRUMENT and out otherwise.
+//
+//   INSTR_COUNT(counter, n)   add n to an algorithmic counter
+//   INSTR_PHASE_BEGIN(phase)  start timing a phase on this thread
+//   INSTR_PHASE_END(phase)    stop it again
+//
+// Without VC_INSTRUMENT the macros are empty, so solvers pay nothing and a
+// dump only reports the peak RSS. With it, every thread counts into its own
+// block (no atomics on the hot paths) and a dump sums the blocks.
+//
+// Phases nest: a phase that is already running on a thread is only timed by
+// its outermost begin/end, and the phases of different threads add up, so
+// solve includes the reduce time of kernelization called from a solver.
+// On Linux, perf_event_open adds cycles, cache misses and branch misses for
+// the whole process. They are read at the outermost begin/end of phases on
+// the thread that called instrumentInit, and skipped when the kernel does
+// not allow them. With glibc, malloc/calloc/realloc/free are interposed to
+// count allocations; -DVC_NO_MALLOC_HOOKS leaves them alone, which sanitizer
+// builds need since they bring their own allocator.
+//
+// Everything is written as one JSON object per line, see instrumentDump().
+
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+typedef enum InstrCounter {
+    INSTR_EDGES_SCANNED,    // adjacency entries and edges walked
+    INSTR_COVER_UPDATES,    // edges changing between covered and uncovered
+    INSTR_NODES,            // search nodes, local search steps, DP table entries
+    INSTR_PRUNES,           // branches cut by a bound
+    INSTR_LEAVES,           // complete covers checked or recorded
+    INSTR_REDUCTIONS,       // reduction rules applied
+    INSTR_NUM_COUNTERS
+} InstrCounter;
+
+typedef enum InstrPhase {
+    PHASE_LOAD,
+    PHASE_BUILD,
+    PHASE_REDUCE,
+    PHASE_SOLVE,
+    PHASE_VERIFY,
+    INSTR_NUM_PHASES
+} InstrPhase;
+
+static const char* const instrCounterNames[INSTR_NUM_COUNTERS] = {
+    "edges_scanned", "cover_updates", "nodes", "prunes", "leaves", "reductions"};
+static const char* const instrPhaseNames[INSTR_NUM_PHASES] = {"load", "build", "reduce", "solve", "verify"};
+
+#define INSTR_NUM_HARDWARE 3
+static const char* const instrHardwareNames[INSTR_NUM_HARDWARE] = {"cycles", "cache_misses", "branch_misses"};
+
+// peak resident set size in kB, 0 where getrusage is missing
+static inline long instrumentPeakRSS(void) {
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024;  // bytes there, kB on Linux
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
+#ifdef VC_INSTRUMENT
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#define INSTR_COUNT(counter, n) (instrumentLocal()->counts[(counter)] += (int64_t)(n))
+#define INSTR_PHASE_BEGIN(phase) instrumentPhaseBegin(phase)
+#define INSTR_PHASE_END(phase) instrumentPhaseEnd(phase)
+
+// one per thread, kept on a list until exit so a dump can sum them
+typedef struct InstrBlock {
+    int64_t counts[INSTR_NUM_COUNTERS];
+    int depth[INSTR_NUM_PHASES];
+    double started[INSTR_NUM_PHASES];
+    double seconds[INSTR_NUM_PHASES];
+    int64_t calls[INSTR_NUM_PHASES];
+    uint64_t hardwareStarted[INSTR_NUM_PHASES][INSTR_NUM_HARDWARE];
+    uint64_t hardware[INSTR_NUM_PHASES][INSTR_NUM_HARDWARE];
+    struct InstrBlock* next;
+} InstrBlock;
+
+typedef struct Instrumentation {
+    pthread_mutex_t lock;
+    InstrBlock* blocks;
+    InstrBlock* owner;               // block of the thread that opened the hardware counters
+    int hardwareFds[INSTR_NUM_HARDWARE];
+    bool hardware;
+    uint64_t hardwareBase[INSTR_NUM_HARDWARE];
+    atomic_llong allocations;
+    atomic_llong frees;
+    atomic_llong allocatedBytes;
+} Instrumentation;
+
+static Instrumentation instrumentation = {PTHREAD_MUTEX_INITIALIZER, NULL, NULL, {-1, -1, -1}, false, {0}, 0, 0, 0};
+static _Thread_local InstrBlock* instrBlock = NULL;
+
+static inline InstrBlock* instrumentLocal(void) {
+    if (instrBlock == NULL) {
+        InstrBlock* block = (InstrBlock*)calloc(1, sizeof(InstrBlock));
+        if (block == NULL) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        pthread_mutex_lock(&instrumentation.lock);
+        block->next = instrumentation.blocks;
+        instrumentation.blocks = block;
+        pthread_mutex_unlock(&instrumentation.lock);
+        instrBlock = block;
+    }
+    return instrBlock;
+}
+
+static inline double instrumentNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// current hardware counts, false when they are not open
+static inline bool instrumentReadHardware(uint64_t* values) {
+    if (!instrumentation.hardware) return false;
+#ifdef __linux__
+    for (int i = 0; i < INSTR_NUM_HARDWARE; i++) {
+        values[i] = 0;
+        if (read(instrumentation.hardwareFds[i], &values[i], sizeof(uint64_t)) != (ssize_t)sizeof(uint64_t)) {
+            return false;
+        }
+    }
+    return true;
+#else
+    (void)values;
+    return false;
+#endif
+}
+
+static inline void instrumentPhaseBegin(InstrPhase phase) {
+    InstrBlock* block = instrumentLocal();
+    if (block->depth[phase]++ > 0) return;
+    block->calls[phase]++;
+    if (block == instrumentation.owner) {
+        instrumentReadHardware(block->hardwareStarted[phase]);
+    }
+    block->started[phase] = instrumentNow();
+}
+
+static inline void instrumentPhaseEnd(InstrPhase phase) {
+    InstrBlock* block = instrumentLocal();
+    if (--block->depth[phase] > 0) return;
+    block->seconds[phase] += instrumentNow() - block->started[phase];
+    uint64_t values[INSTR_NUM_HARDWARE];
+    if (block == instrumentation.owner && instrumentReadHardware(values)) {
+        for (int i = 0; i < INSTR_NUM_HARDWARE; i++) {
+            block->hardware[phase][i] += values[i] - block->hardwareStarted[phase][i];
+        }
+    }
+}
+
+// Open the hardware counters for this process and its future threads, and
+// make the calling thread the one that reads them. Safe to call once only.
+static inline void instrumentInit(void) {
+    instrumentation.owner = instrumentLocal();
+#ifdef __linux__
+    static const uint64_t configs[INSTR_NUM_HARDWARE] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    bool opened = true;
+    for (int i = 0; i < INSTR_NUM_HARDWARE; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        attr.inherit = 1;  // threads count once they are joined
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        instrumentation.hardwareFds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (instrumentation.hardwareFds[i] < 0) opened = false;
+    }
+    if (!opened) {
+        for (int i = 0; i < INSTR_NUM_HARDWARE; i++) {
+            if (instrumentation.hardwareFds[i] >= 0) close(instrumentation.hardwareFds[i]);
+            instrumentation.hardwareFds[i] = -1;
+        }
+    }
+    instrumentation.hardware = opened;
+    instrumentReadHardware(instrumentation.hardwareBase);
+#endif
+}
+
+// Zero every counter, for a fresh measurement. No other thread may be
+// counting at the time. The peak RSS is reset too where Linux allows it.
+static inline void instrumentReset(void) {
+    pthread_mutex_lock(&instrumentation.lock);
+    // running phases keep their start, only the totals go
+    for (InstrBlock* block = instrumentation.blocks; block != NULL; block = block->next) {
+        memset(block->counts, 0, sizeof(block->counts));
+        memset(block->seconds, 0, sizeof(block->seconds));
+        memset(block->calls, 0, sizeof(block->calls));
+        memset(block->hardware, 0, sizeof(block->hardware));
+    }
+    pthread_mutex_unlock(&instrumentation.lock);
+    instrumentReadHardware(instrumentation.hardwareBase);
+    atomic_store(&instrumentation.allocations, 0);
+    atomic_store(&instrumentation.frees, 0);
+    atomic_store(&instrumentation.allocatedBytes, 0);
+#ifdef __linux__
+    FILE* clearRefs = fopen("/proc/self/clear_refs", "w");
+    if (clearRefs != NULL) {
+        fputs("5", clearRefs);
+        fclose(clearRefs);
+    }
+#endif
+}
+
+// the fields of the stats object, without the braces
+static inline void instrumentWriteFields(FILE* out) {
+    int64_t counts[INSTR_NUM_COUNTERS] = {0};
+    double seconds[INSTR_NUM_PHASES] = {0};
+    int64_t calls[INSTR_NUM_PHASES] = {0};
+    uint64_t hardware[INSTR_NUM_PHASES][INSTR_NUM_HARDWARE] = {{0}};
+    pthread_mutex_lock(&instrumentation.lock);
+    for (InstrBlock* block = instrumentation.blocks; block != NULL; block = block->next) {
+        for (int c = 0; c < INSTR_NUM_COUNTERS; c++) {
+            counts[c] += block->counts[c];
+        }
+        for (int p = 0; p < INSTR_NUM_PHASES; p++) {
+            seconds[p] += block->seconds[p];
+            calls[p] += block->calls[p];
+            for (int h = 0; h < INSTR_NUM_HARDWARE; h++) {
+                hardware[p][h] += block->hardware[p][h];
+            }
+        }
+    }
+    pthread_mutex_unlock(&instrumentation.lock);
+
+    fprintf(out, "\"instrumented\":true,\"counters\":{");
+    for (int c = 0; c < INSTR_NUM_COUNTERS; c++) {
+        fprintf(out, "%s\"%s\":%lld", c ? "," : "", instrCounterNames[c], (long long)counts[c]);
+    }
+    fprintf(out, "},\"phases\":{");
+    for (int p = 0; p < INSTR_NUM_PHASES; p++) {
+        fprintf(out, "%s\"%s\":{\"seconds\":%.9f,\"calls\":%lld", p ? "," : "", instrPhaseNames[p], seconds[p],
+                (long long)calls[p]);
+        for (int h = 0; h < INSTR_NUM_HARDWARE && instrumentation.hardware; h++) {
+            fprintf(out, ",\"%s\":%llu", instrHardwareNames[h], (unsigned long long)hardware[p][h]);
+        }
+        fprintf(out, "}");
+    }
+    fprintf(out, "},\"hardware\":");
+    uint64_t values[INSTR_NUM_HARDWARE];
+    if (instrumentReadHardware(values)) {
+        fprintf(out, "{");
+        for (int h = 0; h < INSTR_NUM_HARDWARE; h++) {
+            fprintf(out, "%s\"%s\":%llu", h ? "," : "", instrHardwareNames[h],
+                    (unsigned long long)(values[h] - instrumentation.hardwareBase[h]));
+        }
+        fprintf(out, "}");
+    } else {
+        fprintf(out, "null");
+    }
+    fprintf(out, ",\"peak_rss_kb\":%ld,\"allocations\":%lld,\"frees\":%lld,\"allocated_bytes\":%lld",
+            instrumentPeakRSS(), (long long)atomic_load(&instrumentation.allocations),
+            (long long)atomic_load(&instrumentation.frees), (long long)atomic_load(&instrumentation.allocatedBytes));
+}
+
+// Allocation counting by interposing the glibc allocator. Each program is a
+// single translation unit, so these definitions replace malloc for all of it.
+#if defined(__GLIBC__) && !defined(VC_NO_MALLOC_HOOKS)
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+extern void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+    atomic_fetch_add_explicit(&instrumentation.allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&instrumentation.allocatedBytes, (long long)size, memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    atomic_fetch_add_explicit(&instrumentation.allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&instrumentation.allocatedBytes, (long long)(count * size), memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    atomic_fetch_add_explicit(&instrumentation.allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&instrumentation.allocatedBytes, (long long)size, memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) {
+    if (ptr != NULL) atomic_fetch_add_explicit(&instrumentation.frees, 1, memory_order_relaxed);
+    __libc_free(ptr);
+}
+#endif
+
+#else
+
+#define INSTR_COUNT(counter, n) ((void)0)
+#define INSTR_PHASE_BEGIN(phase) ((void)0)
+#define INSTR_PHASE_END(phase) ((void)0)
+
+static inline void instrumentInit(void) {}
+static inline void instrumentReset(void) {}
+
+static inline void instrumentWriteFields(FILE* out) {
+    fprintf(out, "\"instrumented\":false,\"peak_rss_kb\":%ld", instrumentPeakRSS());
+}
+
+#endif
+
+// Append {"program":..., "run":..., <stats>} as one line to path, "-" is stdout.
+// Returns false if the file cannot be opened.
+static inline bool instrumentDump(const char* path, const char* program, const char* run) {
+    FILE* out = strcmp(path, "-") == 0 ? stdout : fopen(path, "a");
+    if (out == NULL) {
+        perror(path);
+        return false;
+    }
+    fprintf(out, "{\"program\":\"%s\",\"run\":\"", program);
+    // run is usually a file name, escape what JSON needs
+    for (const char* c = run; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            fprintf(out, "\\%c", *c);
+        } else if ((unsigned char)*c < 0x20) {
+            fprintf(out, "\\u%04x", (unsigned char)*c);
+        } else {
+            fputc(*c, out);
+        }
+    }
+    fprintf(out, "\",");
+    instrumentWriteFields(out);
+    fprintf(out, "}\n");
+    if (out != stdout) {
+        fclose(out);
+    } else {
+        fflush(out);
+    }
+    return true;
+}
+
+static const char* instrStatsPath = NULL;
+static const char* instrStatsProgram = NULL;
+static char instrStatsRun[256];
+
+static inline void instrumentDumpAtExit(void) {
+    instrumentDump(instrStatsPath, instrStatsProgram, instrStatsRun);
+}
+
+// Take "--stats <file>" out of the arguments. When present, the counters are
+// set up and dumped to file when the program exits, labelled with the rest
+// of the command line. Returns true if the option was given.
+static inline bool instrumentStatsOption(int* argc, char* argv[], const char* program) {
+    int kept = 1;
+    for (int i = 1; i < *argc; i++) {
+        if (strcmp(argv[i], "--stats") == 0 && i + 1 < *argc) {
+            instrStatsPath = argv[++i];
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    *argc = kept;
+    argv[kept] = NULL;
+    if (instrStatsPath == NULL) return false;
+
+    size_t used = 0;
+    instrStatsRun[0] = '\0';
+    for (int i = 1; i < kept && used + 1 < sizeof(instrStatsRun); i++) {
+        used += (size_t)snprintf(instrStatsRun + used, sizeof(instrStatsRun) - used, "%s%s", i > 1 ? " " : "", argv[i]);
+    }
+    instrStatsProgram = program;
+    instrumentInit();
+    atexit(instrumentDumpAtExit);
+    return true;
+}
+
+#endif
@@ -0,0 +1,638 @@
+// Kernelization
+// Reduction rules shared by every solver, applied before solving.
+// The input is an edge list given as 2 ints per edge, so an array of
+// Edge {int u; int v;} from any of the programs can be passed directly.
+// kernelize() returns a smaller graph plus what is needed to lift a cover
+// of that graph back to a cover of the original one.
+
+#ifndef KERNELIZATION_H
+#define KERNELIZATION_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "bipartite.h"
+
+// Degree 2 fold: v was removed with its neighbors u and w, which were merged
+// into the new vertex folded. If folded ends up in the cover so do u and w, otherwise v does.
+typedef struct FoldRecord {
+    int v, u, w;
+    int folded;
+} FoldRecord;
+
+typedef struct Kernel {
+    int numVertices;        // vertices left in the kernel, labelled 0..numVertices-1
+    int64_t numEdges;
+    int* endpoints;         // kernel edges, 2 entries per edge
+    int* kernelToInternal;  // kernel label -> internal vertex id
+
+    int originalVertices;   // internal ids below this are the original vertices
+    int internalVertices;   // original vertices plus one id per fold
+    bool* forcedIn;         // internal ids the rules put into the cover
+    FoldRecord* folds;
+    int numFolds;
+    int coverOffset;        // cover vertices already accounted for by the rules
+    bool infeasible;        // the budget rule proved no cover of size <= budget exists
+    int lowerBound;         // LP lower bound on a cover of the original graph (within the budget, if any)
+
+    // how often each rule fired
+    int isolatedRemoved;
+    int pendantsTaken;
+    int degreeTwoTriangles;
+    int degreeTwoFolds;
+    int dominatedTaken;
+    int crownTaken;
+    int highDegreeTaken;
+    int lpTaken;
+    int lpDropped;
+} Kernel;
+
+// Mutable graph the rules work on. Adjacency lists may hold removed
+// vertices, they are skipped and dropped the next time the list is compacted.
+typedef struct ReductionGraph {
+    int capacity;
+    int count;
+    int** adj;
+    int* adjSize;
+    int* adjCap;
+    int* degree;      // number of live neighbors
+    bool* removed;
+    bool* forcedIn;
+    int* mark;
+    int stamp;
+    int* worklist;
+    int worklistSize;
+    int worklistCap;
+    int64_t liveEdges;
+} ReductionGraph;
+
+static void* kernelAlloc(size_t size) {
+    void* ptr = malloc(size > 0 ? size : 1);
+    if (ptr == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+static void kernelAppend(ReductionGraph* rg, int v, int w) {
+    if (rg->adjSize[v] == rg->adjCap[v]) {
+        rg->adjCap[v] = rg->adjCap[v] ? 2 * rg->adjCap[v] : 4;
+        rg->adj[v] = (int*)realloc(rg->adj[v], rg->adjCap[v] * sizeof(int));
+        if (rg->adj[v] == NULL) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    rg->adj[v][rg->adjSize[v]++] = w;
+}
+
+static void kernelPushWork(ReductionGraph* rg, int v) {
+    if (rg->worklistSize == rg->worklistCap) {
+        rg->worklistCap = rg->worklistCap ? 2 * rg->worklistCap : 64;
+        rg->worklist = (int*)realloc(rg->worklist, rg->worklistCap * sizeof(int));
+        if (rg->worklist == NULL) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    rg->worklist[rg->worklistSize++] = v;
+}
+
+// drop removed vertices from the adjacency list of v
+static void kernelCompact(ReductionGraph* rg, int v) {
+    int write = 0;
+    for (int i = 0; i < rg->adjSize[v]; i++) {
+        if (!rg->removed[rg->adj[v][i]]) {
+            rg->adj[v][write++] = rg->adj[v][i];
+        }
+    }
+    rg->adjSize[v] = write;
+}
+
+// remove v from the graph, into the cover or out of it
+static void kernelRemove(ReductionGraph* rg, int v, bool intoCover) {
+    kernelCompact(rg, v);
+    rg->removed[v] = true;
+    rg->forcedIn[v] = intoCover;
+    for (int i = 0; i < rg->adjSize[v]; i++) {
+        int w = rg->adj[v][i];
+        rg->degree[w]--;
+        rg->liveEdges--;
+        if (rg->degree[w] <= 2) {
+            kernelPushWork(rg, w);
+        }
+    }
+    rg->degree[v] = 0;
+}
+
+static bool kernelAdjacent(ReductionGraph* rg, int a, int b) {
+    if (rg->adjSize[a] > rg->adjSize[b]) {
+        int tmp = a;
+        a = b;
+        b = tmp;
+    }
+    for (int i = 0; i < rg->adjSize[a]; i++) {
+        if (rg->adj[a][i] == b) return true;
+    }
+    return false;
+}
+
+static ReductionGraph* createReductionGraph(int numVertices, const int* endpoints, int64_t numEdges) {
+    ReductionGraph* rg = (ReductionGraph*)kernelAlloc(sizeof(ReductionGraph));
+    // every fold removes three vertices and adds one, so there are at most n / 2 folds
+    rg->capacity = numVertices + numVertices / 2 + 1;
+    rg->count = numVertices;
+    rg->adj = (int**)calloc(rg->capacity, sizeof(int*));
+    rg->adjSize = (int*)calloc(rg->capacity, sizeof(int));
+    rg->adjCap = (int*)calloc(rg->capacity, sizeof(int));
+    rg->degree = (int*)calloc(rg->capacity, sizeof(int));
+    rg->removed = (bool*)calloc(rg->capacity, sizeof(bool));
+    rg->forcedIn = (bool*)calloc(rg->capacity, sizeof(bool));
+    rg->mark = (int*)calloc(rg->capacity, sizeof(int));
+    if (!rg->adj || !rg->adjSize || !rg->adjCap || !rg->degree || !rg->removed || !rg->forcedIn || !rg->mark) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    rg->stamp = 0;
+    rg->worklist = NULL;
+    rg->worklistSize = 0;
+    rg->worklistCap = 0;
+    rg->liveEdges = 0;
+
+    // self loops force their vertex into the cover, parallel edges are merged
+    for (int64_t i = 0; i < numEdges; i++) {
+        int u = endpoints[2 * i];
+        int v = endpoints[2 * i + 1];
+        if (u == v) {
+            rg->forcedIn[u] = true;
+            continue;
+        }
+        kernelAppend(rg, u, v);
+        kernelAppend(rg, v, u);
+    }
+    for (int v = 0; v < numVertices; v++) {
+        rg->stamp++;
+        int write = 0;
+        for (int i = 0; i < rg->adjSize[v]; i++) {
+            int w = rg->adj[v][i];
+            if (rg->mark[w] != rg->stamp) {
+                rg->mark[w] = rg->stamp;
+                rg->adj[v][write++] = w;
+            }
+        }
+        rg->adjSize[v] = write;
+        rg->degree[v] = write;
+        rg->liveEdges += write;
+    }
+    rg->liveEdges /= 2;
+
+    for (int v = 0; v < numVertices; v++) {
+        if (rg->forcedIn[v]) {
+            kernelRemove(rg, v, true);
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        kernelPushWork(rg, v);
+    }
+    return rg;
+}
+
+static void freeReductionGraph(ReductionGraph* rg) {
+    for (int v = 0; v < rg->capacity; v++) {
+        free(rg->adj[v]);
+    }
+    free(rg->adj);
+    free(rg->adjSize);
+    free(rg->adjCap);
+    free(rg->degree);
+    free(rg->removed);
+    free(rg->forcedIn);
+    free(rg->mark);
+    free(rg->worklist);
+    free(rg);
+}
+
+// merge u and w (the neighbors of the degree 2 vertex v) into a new vertex
+static void kernelFold(ReductionGraph* rg, Kernel* kernel, int v, int u, int w) {
+    int folded = rg->count++;
+    rg->stamp++;
+    rg->mark[v] = rg->mark[u] = rg->mark[w] = rg->stamp;
+    int ends[2] = {u, w};
+    for (int e = 0; e < 2; e++) {
+        kernelCompact(rg, ends[e]);
+        for (int i = 0; i < rg->adjSize[ends[e]]; i++) {
+            int y = rg->adj[ends[e]][i];
+            if (rg->mark[y] != rg->stamp) {
+                rg->mark[y] = rg->stamp;
+                kernelAppend(rg, folded, y);
+            }
+        }
+    }
+
+    kernelRemove(rg, v, false);
+    kernelRemove(rg, u, false);
+    kernelRemove(rg, w, false);
+
+    for (int i = 0; i < rg->adjSize[folded]; i++) {
+        int y = rg->adj[folded][i];
+        kernelAppend(rg, y, folded);
+        rg->degree[y]++;
+        rg->liveEdges++;
+    }
+    rg->degree[folded] = rg->adjSize[folded];
+    kernelPushWork(rg, folded);
+
+    FoldRecord record = {v, u, w, folded};
+    kernel->folds[kernel->numFolds++] = record;
+    kernel->coverOffset++;
+    kernel->degreeTwoFolds++;
+}
+
+// degree 0, 1 and 2 rules, driven by the worklist of vertices whose degree dropped
+static void kernelLowDegreeRules(ReductionGraph* rg, Kernel* kernel) {
+    while (rg->worklistSize > 0) {
+        int v = rg->worklist[--rg->worklistSize];
+        if (rg->removed[v]) continue;
+
+        if (rg->degree[v] == 0) {
+            kernelRemove(rg, v, false);
+            kernel->isolatedRemoved++;
+        } else if (rg->degree[v] == 1) {
+            kernelCompact(rg, v);
+            int u = rg->adj[v][0];
+            kernelRemove(rg, u, true);
+            kernelRemove(rg, v, false);
+            kernel->coverOffset++;
+            kernel->pendantsTaken++;
+        } else if (rg->degree[v] == 2) {
+            kernelCompact(rg, v);
+            int u = rg->adj[v][0];
+            int w = rg->adj[v][1];
+            kernelCompact(rg, u);
+            kernelCompact(rg, w);
+            if (kernelAdjacent(rg, u, w)) {
+                // triangle: some optimal cover holds both u and w
+                kernelRemove(rg, u, true);
+                kernelRemove(rg, w, true);
+                kernelRemove(rg, v, false);
+                kernel->coverOffset += 2;
+                kernel->degreeTwoTriangles++;
+            } else {
+                kernelFold(rg, kernel, v, u, w);
+            }
+        }
+    }
+}
+
+// Domination: if u and v are adjacent and N[v] is a subset of N[u],
+// some optimal cover contains u
+static bool kernelDominationRule(ReductionGraph* rg, Kernel* kernel) {
+    bool changed = false;
+    for (int u = 0; u < rg->count; u++) {
+        if (rg->removed[u]) continue;
+        kernelCompact(rg, u);
+        rg->stamp++;
+        rg->mark[u] = rg->stamp;
+        for (int i = 0; i < rg->adjSize[u]; i++) {
+            rg->mark[rg->adj[u][i]] = rg->stamp;
+        }
+
+        for (int i = 0; i < rg->adjSize[u]; i++) {
+            int v = rg->adj[u][i];
+            if (rg->degree[v] > rg->degree[u]) continue;
+            bool dominated = true;
+            for (int j = 0; j < rg->adjSize[v] && dominated; j++) {
+                int y = rg->adj[v][j];
+                if (!rg->removed[y] && rg->mark[y] != rg->stamp) {
+                    dominated = false;
+                }
+            }
+            if (dominated) {
+                kernelRemove(rg, u, true);
+                kernel->coverOffset++;
+                kernel->dominatedTaken++;
+                changed = true;
+                break;
+            }
+        }
+        if (changed && rg->worklistSize > 0) {
+            kernelLowDegreeRules(rg, kernel);
+        }
+    }
+    return changed;
+}
+
+// Crown reduction. The vertices left unmatched by a maximal matching form an
+// independent set O. A maximum matching between O and N(O) is grown from the
+// vertices of O it leaves free: I collects them and the partners of H = N(I).
+// (I, H) is then a crown, H goes into the cover and I is dropped.
+static bool kernelCrownRule(ReductionGraph* rg, Kernel* kernel) {
+    int count = rg->count;
+    if (count <= 0) return false;
+    int* mate = (int*)kernelAlloc(count * sizeof(int));
+    int* parent = (int*)kernelAlloc(count * sizeof(int));
+    int* queue = (int*)kernelAlloc(count * sizeof(int));
+    bool* outside = (bool*)calloc(count, sizeof(bool));
+    bool* inCrown = (bool*)calloc(count, sizeof(bool));
+    bool* inHead = (bool*)calloc(count, sizeof(bool));
+    if (!outside || !inCrown || !inHead) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    // maximal matching, the unmatched vertices are the independent set O
+    for (int v = 0; v < count; v++) {
+        mate[v] = -1;
+    }
+    for (int v = 0; v < count; v++) {
+        if (rg->removed[v] || mate[v] != -1) continue;
+        kernelCompact(rg, v);
+        for (int i = 0; i < rg->adjSize[v]; i++) {
+            int w = rg->adj[v][i];
+            if (mate[w] == -1) {
+                mate[v] = w;
+                mate[w] = v;
+                break;
+            }
+        }
+    }
+    for (int v = 0; v < count; v++) {
+        outside[v] = !rg->removed[v] && mate[v] == -1 && rg->degree[v] > 0;
+        mate[v] = -1;
+    }
+
+    // maximum matching between O and N(O) with BFS augmenting paths
+    for (int root = 0; root < count; root++) {
+        if (!outside[root]) continue;
+        rg->stamp++;
+        int head = 0, tail = 0;
+        queue[tail++] = root;
+        int freeEnd = -1;
+        while (head < tail && freeEnd == -1) {
+            int o = queue[head++];
+            for (int i = 0; i < rg->adjSize[o]; i++) {
+                int h = rg->adj[o][i];
+                if (rg->mark[h] == rg->stamp) continue;
+                rg->mark[h] = rg->stamp;
+                parent[h] = o;
+                if (mate[h] == -1) {
+                    freeEnd = h;
+                    break;
+                }
+                queue[tail++] = mate[h];
+            }
+        }
+        // flip the alternating path
+        while (freeEnd != -1) {
+            int o = parent[freeEnd];
+            int next = mate[o];
+            mate[o] = freeEnd;
+            mate[freeEnd] = o;
+            freeEnd = next;
+        }
+    }
+
+    // grow the crown from the free vertices of O
+    int head = 0, tail = 0;
+    for (int v = 0; v < count; v++) {
+        if (outside[v] && mate[v] == -1) {
+            inCrown[v] = true;
+            queue[tail++] = v;
+        }
+    }
+    while (head < tail) {
+        int o = queue[head++];
+        for (int i = 0; i < rg->adjSize[o]; i++) {
+            int h = rg->adj[o][i];
+            if (inHead[h]) continue;
+            inHead[h] = true;
+            int partner = mate[h];
+            if (partner != -1 && !inCrown[partner]) {
+                inCrown[partner] = true;
+                queue[tail++] = partner;
+            }
+        }
+    }
+
+    bool changed = false;
+    for (int v = 0; v < count; v++) {
+        if (inHead[v] && !rg->removed[v]) {
+            kernelRemove(rg, v, true);
+            kernel->coverOffset++;
+            kernel->crownTaken++;
+            changed = true;
+        }
+    }
+    for (int v = 0; v < count; v++) {
+        if (inCrown[v] && !rg->removed[v]) {
+            kernelRemove(rg, v, false);
+        }
+    }
+
+    free(mate);
+    free(parent);
+    free(queue);
+    free(outside);
+    free(inCrown);
+    free(inHead);
+    return changed;
+}
+
+// Nemhauser-Trotter: solve the LP relaxation of what is left, take the vertices
+// at 1 and drop the vertices at 0. Every rule so far keeps OPT = coverOffset +
+// OPT(rest), so coverOffset + ceil(LP) also bounds the original graph.
+static bool kernelLPRule(ReductionGraph* rg, Kernel* kernel) {
+    int count = rg->count;
+    int* label = (int*)kernelAlloc(count * sizeof(int));
+    int* vertexOf = (int*)kernelAlloc(count * sizeof(int));
+    int live = 0;
+    for (int v = 0; v < count; v++) {
+        label[v] = -1;
+        if (!rg->removed[v]) {
+            label[v] = live;
+            vertexOf[live++] = v;
+        }
+    }
+    int* endpoints = (int*)kernelAlloc(2 * rg->liveEdges * sizeof(int));
+    int64_t numEdges = 0;
+    for (int v = 0; v < count; v++) {
+        if (rg->removed[v]) continue;
+        kernelCompact(rg, v);
+        for (int i = 0; i < rg->adjSize[v]; i++) {
+            int w = rg->adj[v][i];
+            if (label[v] < label[w]) {
+                endpoints[2 * numEdges] = label[v];
+                endpoints[2 * numEdges + 1] = label[w];
+                numEdges++;
+            }
+        }
+    }
+
+    char* twiceX = (char*)kernelAlloc(live);
+    int64_t value = vertexCoverLP(live, endpoints, numEdges, twiceX);
+    int bound = kernel->coverOffset + (int)((value + 1) / 2);
+    if (bound > kernel->lowerBound) kernel->lowerBound = bound;
+
+    // take first: the neighbors of a vertex at 0 are all at 1
+    bool changed = false;
+    for (int i = 0; i < live; i++) {
+        if (twiceX[i] == 2) {
+            kernelRemove(rg, vertexOf[i], true);
+            kernel->coverOffset++;
+            kernel->lpTaken++;
+            changed = true;
+        }
+    }
+    for (int i = 0; i < live; i++) {
+        if (twiceX[i] == 0 && !rg->removed[vertexOf[i]]) {
+            kernelRemove(rg, vertexOf[i], false);
+            kernel->lpDropped++;
+            changed = true;
+        }
+    }
+
+    free(label);
+    free(vertexOf);
+    free(endpoints);
+    free(twiceX);
+    return changed;
+}
+
+// Buss rule: with k cover vertices left to spend, a vertex of degree > k has to be taken
+static bool kernelHighDegreeRule(ReductionGraph* rg, Kernel* kernel, int budget) {
+    bool changed = false;
+    for (int v = 0; v < rg->count; v++) {
+        int remaining = budget - kernel->coverOffset;
+        if (remaining < 0) break;
+        if (!rg->removed[v] && rg->degree[v] > remaining) {
+            kernelRemove(rg, v, true);
+            kernel->coverOffset++;
+            kernel->highDegreeTaken++;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+// Reduce the graph until no rule applies. budget < 0 means no size bound is known,
+// otherwise the Buss rule is applied and infeasible is set when no cover of
+// size <= budget can exist.
+static Kernel* kernelize(int numVertices, const int* endpoints, int64_t numEdges, int budget) {
+    INSTR_PHASE_BEGIN(PHASE_REDUCE);
+    Kernel* kernel = (Kernel*)calloc(1, sizeof(Kernel));
+    if (kernel == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    ReductionGraph* rg = createReductionGraph(numVertices, endpoints, numEdges);
+    kernel->originalVertices = numVertices;
+    kernel->folds = (FoldRecord*)kernelAlloc((numVertices / 2 + 1) * sizeof(FoldRecord));
+    for (int v = 0; v < numVertices; v++) {
+        if (rg->forcedIn[v]) kernel->coverOffset++;
+    }
+
+    bool changed = true;
+    while (changed) {
+        kernelLowDegreeRules(rg, kernel);
+        changed = false;
+        if (budget >= 0) {
+            changed = kernelHighDegreeRule(rg, kernel, budget);
+            if (budget - kernel->coverOffset < 0) {
+                kernel->infeasible = true;
+                break;
+            }
+        }
+        if (!changed) changed = kernelDominationRule(rg, kernel);
+        if (!changed) changed = kernelCrownRule(rg, kernel);
+        if (!changed) changed = kernelLPRule(rg, kernel);
+    }
+
+    if (kernel->lowerBound < kernel->coverOffset) kernel->lowerBound = kernel->coverOffset;
+
+    if (budget >= 0 && !kernel->infeasible) {
+        int64_t remaining = budget - kernel->coverOffset;
+        if (rg->liveEdges > remaining * remaining) {
+            kernel->infeasible = true;
+        }
+    }
+
+    // relabel the live vertices and emit every edge once
+    int* label = (int*)kernelAlloc(rg->count * sizeof(int));
+    kernel->kernelToInternal = (int*)kernelAlloc(rg->count * sizeof(int));
+    kernel->numVertices = 0;
+    for (int v = 0; v < rg->count; v++) {
+        label[v] = -1;
+        if (!rg->removed[v]) {
+            label[v] = kernel->numVertices;
+            kernel->kernelToInternal[kernel->numVertices++] = v;
+        }
+    }
+    kernel->endpoints = (int*)kernelAlloc(2 * rg->liveEdges * sizeof(int));
+    kernel->numEdges = 0;
+    for (int v = 0; v < rg->count; v++) {
+        if (rg->removed[v]) continue;
+        kernelCompact(rg, v);
+        for (int i = 0; i < rg->adjSize[v]; i++) {
+            int w = rg->adj[v][i];
+            if (label[v] < label[w]) {
+                kernel->endpoints[2 * kernel->numEdges] = label[v];
+                kernel->endpoints[2 * kernel->numEdges + 1] = label[w];
+                kernel->numEdges++;
+            }
+        }
+    }
+
+    kernel->internalVertices = rg->count;
+    kernel->forcedIn = (bool*)kernelAlloc(rg->count * sizeof(bool));
+    memcpy(kernel->forcedIn, rg->forcedIn, rg->count * sizeof(bool));
+
+    free(label);
+    freeReductionGraph(rg);
+    INSTR_COUNT(INSTR_REDUCTIONS, kernel->isolatedRemoved + kernel->pendantsTaken + kernel->degreeTwoTriangles +
+                                      kernel->degreeTwoFolds + kernel->dominatedTaken + kernel->crownTaken +
+                                      kernel->highDegreeTaken + kernel->lpTaken + kernel->lpDropped);
+    INSTR_PHASE_END(PHASE_REDUCE);
+    return kernel;
+}
+
+// Turn a cover of the kernel into a cover of the original graph.
+// The returned array has originalVertices entries and is owned by the caller.
+static bool* liftKernelCover(const Kernel* kernel, const bool* kernelCover) {
+    bool* internal = (bool*)kernelAlloc(kernel->internalVertices * sizeof(bool));
+    memcpy(internal, kernel->forcedIn, kernel->internalVertices * sizeof(bool));
+    for (int i = 0; i < kernel->numVertices; i++) {
+        if (kernelCover[i]) {
+            internal[kernel->kernelToInternal[i]] = true;
+        }
+    }
+
+    // undo folds newest first, a fold may have merged vertices made by an earlier one
+    for (int i = kernel->numFolds - 1; i >= 0; i--) {
+        FoldRecord record = kernel->folds[i];
+        if (internal[record.folded]) {
+            internal[record.u] = true;
+            internal[record.w] = true;
+        } else {
+            internal[record.v] = true;
+        }
+    }
+
+    bool* cover = (bool*)kernelAlloc(kernel->originalVertices * sizeof(bool));
+    memcpy(cover, internal, kernel->originalVertices * sizeof(bool));
+    free(internal);
+    return cover;
+}
+
+static void freeKernel(Kernel* kernel) {
+    free(kernel->endpoints);
+    free(kernel->kernelToInternal);
+    free(kernel->forcedIn);
+    free(kernel->folds);
+    free(kernel);
+}
+
+#endif
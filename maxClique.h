@@ -0,0 +1,260 @@
+// Exact vertex cover of dense graphs through maximum clique.
+// A minimum cover is n minus a maximum independent set, and an independent
+// set of G is a clique of its complement. A dense G has a sparse complement,
+// whose cliques are small and easy to bound by coloring, while branching on
+// the vertices of G itself would have to go deep.
+//
+// The search is BBMC (San Segundo et al.), the bitset form of MCQ/MCS:
+// vertices are renumbered in a degeneracy order, the complement is kept as
+// an adjacency bit matrix, and every node colors its candidate set greedily
+// one color class at a time. The number of colors bounds the clique still
+// reachable, candidates are expanded from the highest color down, and the
+// classes that cannot beat the incumbent are never expanded. Candidate
+// sets and neighborhoods are intersected one 64 bit word at a time in plain
+// loops, which compilers vectorize.
+
+#ifndef MAX_CLIQUE_H
+#define MAX_CLIQUE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "graph.h"
+
+typedef struct CliqueLevel {
+    uint64_t* candidates;   // P at this depth
+    uint64_t* uncolored;    // scratch for the coloring
+    uint64_t* colorClass;
+    int* order;             // candidates worth expanding, in color order
+    int* colors;
+} CliqueLevel;
+
+typedef struct CliqueSearch {
+    int n;
+    int words;
+    uint64_t* adj;          // complement adjacency, n rows of words, in search order
+    CliqueLevel* levels;    // allocated on first use, depth never exceeds the clique size
+    int* current;
+    int currentSize;
+    int* best;
+    int bestSize;
+} CliqueSearch;
+
+static inline void* cliqueAlloc(size_t size) {
+    void* p = malloc(size ? size : 1);
+    if (p == NULL) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+static inline CliqueLevel* cliqueLevel(CliqueSearch* search, int depth) {
+    CliqueLevel* level = &search->levels[depth];
+    if (level->candidates == NULL) {
+        size_t bytes = (size_t)search->words * sizeof(uint64_t);
+        level->candidates = (uint64_t*)cliqueAlloc(bytes);
+        level->uncolored = (uint64_t*)cliqueAlloc(bytes);
+        level->colorClass = (uint64_t*)cliqueAlloc(bytes);
+        level->order = (int*)cliqueAlloc((size_t)search->n * sizeof(int));
+        level->colors = (int*)cliqueAlloc((size_t)search->n * sizeof(int));
+    }
+    return level;
+}
+
+// Greedy sequential coloring of the candidates, one color class at a time:
+// a class takes the lowest candidate left and drops its neighbors. Vertices
+// colored below minColor cannot lead to a larger clique and are left out.
+// Returns how many vertices went into order.
+static inline int cliqueColor(const CliqueSearch* search, CliqueLevel* level, int minColor) {
+    int words = search->words;
+    uint64_t* restrict uncolored = level->uncolored;
+    uint64_t* restrict colorClass = level->colorClass;
+    memcpy(uncolored, level->candidates, (size_t)words * sizeof(uint64_t));
+    int first = 0;  // words below first are empty
+    int count = 0;
+    for (int color = 1; first < words; color++) {
+        memcpy(colorClass + first, uncolored + first, (size_t)(words - first) * sizeof(uint64_t));
+        for (int w = first; w < words; w++) {
+            while (colorClass[w]) {
+                int v = w * 64 + __builtin_ctzll(colorClass[w]);
+                uint64_t bit = colorClass[w] & -colorClass[w];
+                uncolored[w] &= ~bit;
+                colorClass[w] &= ~bit;
+                const uint64_t* restrict row = search->adj + (size_t)v * words;
+                for (int x = w; x < words; x++) {
+                    colorClass[x] &= ~row[x];
+                }
+                if (color >= minColor) {
+                    level->order[count] = v;
+                    level->colors[count] = color;
+                    count++;
+                }
+            }
+        }
+        while (first < words && uncolored[first] == 0) first++;
+    }
+    return count;
+}
+
+static void cliqueExpand(CliqueSearch* search, int depth) {
+    INSTR_COUNT(INSTR_NODES, 1);
+    int words = search->words;
+    CliqueLevel* level = cliqueLevel(search, depth);
+    int count = cliqueColor(search, level, search->bestSize - search->currentSize + 1);
+
+    for (int i = count - 1; i >= 0; i--) {
+        if (search->currentSize + level->colors[i] <= search->bestSize) {
+            INSTR_COUNT(INSTR_PRUNES, 1);
+            return;
+        }
+        int v = level->order[i];
+        search->current[search->currentSize++] = v;
+
+        // P & N(v) for the next level
+        CliqueLevel* next = cliqueLevel(search, depth + 1);
+        const uint64_t* restrict row = search->adj + (size_t)v * words;
+        const uint64_t* restrict candidates = level->candidates;
+        uint64_t* restrict nextCandidates = next->candidates;
+        uint64_t any = 0;
+        for (int w = 0; w < words; w++) {
+            nextCandidates[w] = candidates[w] & row[w];
+            any |= nextCandidates[w];
+        }
+        INSTR_COUNT(INSTR_EDGES_SCANNED, words);
+
+        if (any) {
+            cliqueExpand(search, depth + 1);
+        } else {
+            INSTR_COUNT(INSTR_LEAVES, 1);
+            if (search->currentSize > search->bestSize) {
+                search->bestSize = search->currentSize;
+                memcpy(search->best, search->current, (size_t)search->currentSize * sizeof(int));
+            }
+        }
+        search->currentSize--;
+        level->candidates[v / 64] &= ~(1ULL << (v % 64));
+    }
+}
+
+// Minimum vertex cover of an edge list through a maximum clique of the
+// complement, fills cover (n entries) and returns its size. Self loops are
+// not allowed, kernels never have them. Memory is n^2 / 8 bytes for the bit
+// matrix plus a few rows per level of the search.
+static inline int maxCliqueVertexCover(int n, const Edge* edges, int64_t numEdges, bool* cover) {
+    if (n == 0) return 0;
+    int words = (n + 63) / 64;
+
+    // G as a bit matrix with parallel edges merged, and its degrees
+    int* degree = (int*)calloc((size_t)n, sizeof(int));
+    bool* placed = (bool*)calloc((size_t)n, sizeof(bool));
+    int* vertexAt = (int*)cliqueAlloc((size_t)n * sizeof(int));
+    uint64_t* graphRows = (uint64_t*)calloc((size_t)n * words, sizeof(uint64_t));
+    if (!degree || !placed || !graphRows) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int64_t i = 0; i < numEdges; i++) {
+        int u = edges[i].u;
+        int v = edges[i].v;
+        uint64_t* rowU = graphRows + (size_t)u * words;
+        if (!((rowU[v / 64] >> (v % 64)) & 1)) {
+            rowU[v / 64] |= 1ULL << (v % 64);
+            graphRows[(size_t)v * words + u / 64] |= 1ULL << (u % 64);
+            degree[u]++;
+            degree[v]++;
+        }
+    }
+
+    // degeneracy order of the complement: the vertex of smallest complement
+    // degree goes last, so the dense core is numbered first and colored first
+    int* remaining = (int*)cliqueAlloc((size_t)n * sizeof(int));
+    for (int v = 0; v < n; v++) {
+        remaining[v] = n - 1 - degree[v];
+    }
+    for (int slot = n - 1; slot >= 0; slot--) {
+        int pick = -1;
+        for (int v = 0; v < n; v++) {
+            if (!placed[v] && (pick < 0 || remaining[v] < remaining[pick])) pick = v;
+        }
+        placed[pick] = true;
+        vertexAt[slot] = pick;
+        const uint64_t* row = graphRows + (size_t)pick * words;
+        for (int v = 0; v < n; v++) {
+            if (!placed[v] && v != pick && !((row[v / 64] >> (v % 64)) & 1)) remaining[v]--;
+        }
+    }
+
+    // complement bit matrix in search order
+    CliqueSearch search;
+    search.n = n;
+    search.words = words;
+    search.adj = (uint64_t*)calloc((size_t)n * words, sizeof(uint64_t));
+    search.levels = (CliqueLevel*)calloc((size_t)n + 2, sizeof(CliqueLevel));
+    search.current = (int*)cliqueAlloc((size_t)n * sizeof(int));
+    search.best = (int*)cliqueAlloc((size_t)n * sizeof(int));
+    if (!search.adj || !search.levels) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int a = 0; a < n; a++) {
+        const uint64_t* row = graphRows + (size_t)vertexAt[a] * words;
+        uint64_t* adjRow = search.adj + (size_t)a * words;
+        for (int b = 0; b < n; b++) {
+            if (b != a && !((row[vertexAt[b] / 64] >> (vertexAt[b] % 64)) & 1)) {
+                adjRow[b / 64] |= 1ULL << (b % 64);
+            }
+        }
+    }
+    free(graphRows);
+
+    // incumbent: a greedy clique in search order
+    search.bestSize = 0;
+    for (int a = 0; a < n; a++) {
+        bool fits = true;
+        for (int i = 0; i < search.bestSize && fits; i++) {
+            int b = search.best[i];
+            fits = (search.adj[(size_t)a * words + b / 64] >> (b % 64)) & 1;
+        }
+        if (fits) search.best[search.bestSize++] = a;
+    }
+
+    search.currentSize = 0;
+    CliqueLevel* root = cliqueLevel(&search, 0);
+    memset(root->candidates, 0, (size_t)words * sizeof(uint64_t));
+    for (int a = 0; a < n; a++) {
+        root->candidates[a / 64] |= 1ULL << (a % 64);
+    }
+    cliqueExpand(&search, 0);
+
+    // the clique is an independent set of G, everything else is the cover
+    for (int v = 0; v < n; v++) {
+        cover[v] = true;
+    }
+    for (int i = 0; i < search.bestSize; i++) {
+        cover[vertexAt[search.best[i]]] = false;
+    }
+    int size = n - search.bestSize;
+
+    for (int d = 0; d < n + 2; d++) {
+        free(search.levels[d].candidates);
+        free(search.levels[d].uncolored);
+        free(search.levels[d].colorClass);
+        free(search.levels[d].order);
+        free(search.levels[d].colors);
+    }
+    free(search.levels);
+    free(search.adj);
+    free(search.current);
+    free(search.best);
+    free(remaining);
+    free(vertexAt);
+    free(placed);
+    free(degree);
+    return size;
+}
+
+#endif
@@ -0,0 +1,220 @@
+// Parallel maximal matching by deterministic reservations (Blelloch, Fineman
+// and Shun). Every edge gets a random priority from a hash of its index. Each
+// round runs three phases over the edges still active:
+//   reserve  drop edges with a matched endpoint, and write the priority of
+//            every other edge into both endpoint slots with an atomic min
+//   commit   an edge that holds both of its slots is the lowest in its
+//            neighborhood and joins the matching
+//   reset    edges that lost clear their slots for the next round
+// The lowest active edge always commits, and random priorities finish in
+// O(log^2 n) rounds with high probability. The matching is the one the
+// sequential greedy loop finds when it visits edges in priority order, so
+// the cover is the same 2-approximation. For a given seed it is also the
+// same whatever the number of threads.
+//
+// Edges are cut into fixed blocks that threads claim from a shared counter.
+// Each block keeps its active edges as 16 bit offsets at its own start, so
+// the working set is 2 bytes per edge plus 8 bytes per vertex for the slots.
+// The threads are started once per cover and meet at a barrier after every
+// phase. Each phase has its own block counter, cleared by the thread the
+// barrier picks while the next phase runs.
+
+#ifndef PARALLEL_MATCHING_H
+#define PARALLEL_MATCHING_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include "graph.h"
+
+#define MATCHING_BLOCK_EDGES (1 << 16)   // must fit the 16 bit active offsets
+#define MATCHING_EDGE_BITS 36            // low bits of a priority hold the edge index
+
+typedef enum MatchingPhase {
+    MATCHING_RESERVE,
+    MATCHING_COMMIT,
+    MATCHING_RESET
+} MatchingPhase;
+
+typedef struct MatchingJob {
+    const Edge* edges;
+    int64_t numEdges;
+    int64_t numBlocks;
+    uint64_t seed;
+    bool firstRound;          // blocks are still full, active offsets not written yet
+    uint16_t* active;         // numEdges, block b uses its own range
+    int32_t* counts;          // active edges of each block, written by reserve and commit
+    _Atomic uint64_t* slots;  // lowest priority reserving each vertex, UINT64_MAX when free
+    bool* matched;            // the cover
+    atomic_llong nextBlock[3];  // per phase
+    pthread_barrier_t barrier;
+} MatchingJob;
+
+// random high bits, the edge index in the low bits keeps priorities distinct
+static inline uint64_t matchingPriority(uint64_t seed, int64_t edge) {
+    uint64_t z = seed + (uint64_t)edge * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    return (z << MATCHING_EDGE_BITS) | (uint64_t)edge;
+}
+
+static inline void matchingWriteMin(_Atomic uint64_t* slot, uint64_t value) {
+    uint64_t current = atomic_load_explicit(slot, memory_order_relaxed);
+    while (value < current &&
+           !atomic_compare_exchange_weak_explicit(slot, &current, value, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static inline void matchingBlock(MatchingJob* job, MatchingPhase phase, int64_t block) {
+    int64_t base = block * MATCHING_BLOCK_EDGES;
+    int64_t length = job->numEdges - base < MATCHING_BLOCK_EDGES ? job->numEdges - base : MATCHING_BLOCK_EDGES;
+    uint16_t* active = job->active + base;
+    bool full = phase == MATCHING_RESERVE && job->firstRound;
+    int32_t count = full ? (int32_t)length : job->counts[block];
+    int32_t kept = 0;
+
+    for (int32_t k = 0; k < count; k++) {
+        uint16_t local = full ? (uint16_t)k : active[k];
+        int64_t edge = base + local;
+        int u = job->edges[edge].u;
+        int v = job->edges[edge].v;
+        if (phase == MATCHING_RESERVE) {
+            if (job->matched[u] || job->matched[v]) continue;
+            uint64_t priority = matchingPriority(job->seed, edge);
+            matchingWriteMin(&job->slots[u], priority);
+            matchingWriteMin(&job->slots[v], priority);
+            active[kept++] = local;
+        } else if (phase == MATCHING_COMMIT) {
+            uint64_t priority = matchingPriority(job->seed, edge);
+            if (atomic_load_explicit(&job->slots[u], memory_order_relaxed) == priority &&
+                atomic_load_explicit(&job->slots[v], memory_order_relaxed) == priority) {
+                job->matched[u] = true;
+                job->matched[v] = true;
+            } else {
+                active[kept++] = local;
+            }
+        } else {
+            atomic_store_explicit(&job->slots[u], UINT64_MAX, memory_order_relaxed);
+            atomic_store_explicit(&job->slots[v], UINT64_MAX, memory_order_relaxed);
+            kept++;
+        }
+    }
+    // other threads may still be summing the counts during reset
+    if (phase != MATCHING_RESET) job->counts[block] = kept;
+    INSTR_COUNT(INSTR_EDGES_SCANNED, count);
+}
+
+// Claim blocks of phase until none are left, then wait for the other threads.
+// The thread the barrier picks clears the counter of the phase just finished.
+static inline void matchingPhase(MatchingJob* job, MatchingPhase phase) {
+    while (true) {
+        int64_t block = atomic_fetch_add(&job->nextBlock[phase], 1);
+        if (block >= job->numBlocks) break;
+        matchingBlock(job, phase, block);
+    }
+    if (pthread_barrier_wait(&job->barrier) == PTHREAD_BARRIER_SERIAL_THREAD) {
+        atomic_store(&job->nextBlock[phase], 0);
+        if (phase == MATCHING_RESERVE) job->firstRound = false;
+    }
+}
+
+// Rounds of reserve, commit and reset until no edge is left, returns how many.
+// Every thread sums the counts after commit, so all of them stop in the same round.
+static inline int matchingRounds(MatchingJob* job) {
+    int round = 0;
+    while (true) {
+        matchingPhase(job, MATCHING_RESERVE);
+        matchingPhase(job, MATCHING_COMMIT);
+        round++;
+        int64_t remaining = 0;
+        for (int64_t b = 0; b < job->numBlocks; b++) {
+            remaining += job->counts[b];
+        }
+        if (remaining == 0) break;
+        matchingPhase(job, MATCHING_RESET);
+    }
+    return round;
+}
+
+static inline void* matchingWorker(void* arg) {
+    matchingRounds((MatchingJob*)arg);
+    return NULL;
+}
+
+// Maximal matching cover of graph. threads <= 0 uses one per core.
+// rounds (if not NULL) gets the number of rounds taken.
+static inline bool* parallelMatchingCover(const Graph* graph, int threads, uint64_t seed, int* rounds) {
+    int n = graph->numVertices;
+    MatchingJob job;
+    job.edges = graph->edges;
+    job.numEdges = graph->numEdges;
+    job.numBlocks = (graph->numEdges + MATCHING_BLOCK_EDGES - 1) / MATCHING_BLOCK_EDGES;
+    job.seed = seed;
+    job.active = (uint16_t*)malloc(((size_t)graph->numEdges + 1) * sizeof(uint16_t));
+    job.counts = (int32_t*)calloc((size_t)job.numBlocks + 1, sizeof(int32_t));
+    job.slots = (_Atomic uint64_t*)malloc(((size_t)n + 1) * sizeof(uint64_t));
+    job.matched = (bool*)calloc((size_t)n + 1, sizeof(bool));
+    if (!job.active || !job.counts || !job.slots || !job.matched) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    if (graph->numEdges >= ((int64_t)1 << MATCHING_EDGE_BITS)) {
+        fprintf(stderr, "parallel matching: more than 2^%d edges\n", MATCHING_EDGE_BITS);
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        atomic_init(&job.slots[v], UINT64_MAX);
+    }
+
+    if (threads <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+        threads = 1;
+#endif
+    }
+    if (threads > job.numBlocks) threads = job.numBlocks > 0 ? (int)job.numBlocks : 1;
+
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
+    int round = 0;
+    job.firstRound = true;
+    for (int phase = 0; phase < 3; phase++) {
+        atomic_init(&job.nextBlock[phase], 0);
+    }
+    if (job.numBlocks > 0) {
+        // the calling thread is one of the workers
+        pthread_t* workers = (pthread_t*)malloc(threads * sizeof(pthread_t));
+        if (!workers) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        pthread_barrier_init(&job.barrier, NULL, (unsigned)threads);
+        for (int i = 1; i < threads; i++) {
+            pthread_create(&workers[i], NULL, matchingWorker, &job);
+        }
+        round = matchingRounds(&job);
+        for (int i = 1; i < threads; i++) {
+            pthread_join(workers[i], NULL);
+        }
+        pthread_barrier_destroy(&job.barrier);
+        free(workers);
+    }
+    if (rounds != NULL) {
+        *rounds = round;
+    }
+    INSTR_PHASE_END(PHASE_SOLVE);
+
+    free(job.active);
+    free(job.counts);
+    free((void*)job.slots);
+    return job.matched;
+}
+
+#endif
@@ -0,0 +1,721 @@
+// Result cache keyed by the structure of a graph, so a graph (or component)
+// that was solved before costs a hash lookup instead of a new search.
+//
+// The key is the edge list normalized to u <= v, sorted and deduplicated,
+// plus the vertex costs. Graphs of up to CACHE_CANONICAL_VERTICES vertices are
+// relabelled first: color refinement orders the vertices by degree and
+// neighborhood, and when few vertices tie the tied ones are tried in every
+// order and the smallest edge list wins. Isomorphic inputs then share one
+// entry. Ties that are too large to try out are broken by vertex id, which
+// still catches identical inputs. Entries keep the whole canonical edge list
+// and compare it on lookup, so a hash collision can never return a wrong cover.
+//
+// Two tiers:
+//   memory  LRU list of at most capacity entries and CACHE_MEMORY_BYTES,
+//           behind a mutex
+//   disk    optional file of records that is mapped with mapFile and indexed
+//           by hash on open. New results are appended and indexed as they
+//           are written, and a hit is copied into the memory tier.
+//
+// File layout (native byte order): CacheFileHeader, then records of
+//   CacheRecord, numEdges Edge, numVertices int64_t costs if weighted,
+//   (numVertices + 63) / 64 uint64_t cover bits in canonical labels
+
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "graph.h"
+#include "graphLoader.h"
+
+#define CACHE_MAGIC "VCCACHE"
+#define CACHE_VERSION 1
+#define CACHE_BYTE_ORDER 0x01020304u
+#define CACHE_CANONICAL_VERTICES 128   // larger graphs keep their labels
+#define CACHE_PERMUTATION_BUDGET 720   // orders of tied vertices tried at most
+#define CACHE_SOLVER_NAME 16
+#define CACHE_MEMORY_BYTES ((uint64_t)256 << 20)  // memory tier limit, larger entries stay on disk only
+
+typedef struct CacheFileHeader {
+    char magic[8];        // CACHE_MAGIC with its terminating zero
+    uint32_t version;
+    uint32_t byteOrder;
+} CacheFileHeader;
+
+typedef struct CacheRecord {
+    uint64_t recordBytes; // this header and the arrays after it
+    uint64_t hash;
+    int64_t numEdges;
+    int32_t numVertices;
+    int32_t size;         // cover size
+    int32_t weighted;
+    int32_t reserved;
+    char solver[CACHE_SOLVER_NAME];
+} CacheRecord;
+
+// Normalized form of a graph, build with cacheKey and free with freeCacheKey
+typedef struct CacheKey {
+    uint64_t hash;
+    int numVertices;
+    int64_t numEdges;     // distinct edges
+    Edge* edges;          // canonical labels, u <= v, sorted
+    int64_t* weights;     // canonical order, NULL when every vertex costs 1
+    int* label;           // canonical label of every original vertex
+} CacheKey;
+
+typedef struct CacheEntry {
+    CacheRecord record;
+    Edge* edges;          // these three point into the same allocation
+    int64_t* weights;
+    uint64_t* bits;
+    struct CacheEntry* prev;   // LRU order, most recent first
+    struct CacheEntry* next;
+    struct CacheEntry* chain;  // next entry in the same bucket
+} CacheEntry;
+
+typedef struct ResultCache {
+    pthread_mutex_t lock;
+    CacheEntry** buckets;
+    uint64_t bucketMask;
+    CacheEntry* head;
+    CacheEntry* tail;
+    int count;
+    int capacity;
+    uint64_t bytes;       // held by the memory entries
+    uint64_t maxBytes;
+    // disk tier, path is NULL without one
+    char* path;
+    FILE* append;
+    MappedFile file;
+    bool fileMapped;
+    uint64_t validBytes;    // end of the last complete record
+    uint64_t* indexHashes;  // open addressing, offset 0 marks an empty slot
+    uint64_t* indexOffsets;
+    uint64_t indexMask;
+    uint64_t indexCount;
+    int64_t hits;
+    int64_t diskHits;
+    int64_t misses;
+} ResultCache;
+
+// --- keys ---
+
+static inline uint64_t cacheMix(uint64_t h, uint64_t value) {
+    h ^= value + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return h ^ (h >> 31);
+}
+
+static inline int cacheCompareEdges(const void* a, const void* b) {
+    const Edge* x = (const Edge*)a;
+    const Edge* y = (const Edge*)b;
+    if (x->u != y->u) return (x->u > y->u) - (x->u < y->u);
+    return (x->v > y->v) - (x->v < y->v);
+}
+
+static inline int cacheCompareColors(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+// edges[i] relabelled into out, normalized and sorted
+static inline void cacheRelabel(const Edge* edges, int64_t numEdges, const int* label, Edge* out) {
+    for (int64_t i = 0; i < numEdges; i++) {
+        int u = label[edges[i].u];
+        int v = label[edges[i].v];
+        out[i].u = u < v ? u : v;
+        out[i].v = u < v ? v : u;
+    }
+    qsort(out, numEdges, sizeof(Edge), cacheCompareEdges);
+}
+
+static inline int cacheCountColors(const uint64_t* color, int n, uint64_t* scratch) {
+    memcpy(scratch, color, (size_t)n * sizeof(uint64_t));
+    qsort(scratch, n, sizeof(uint64_t), cacheCompareColors);
+    int distinct = 0;
+    for (int i = 0; i < n; i++) {
+        if (i == 0 || scratch[i] != scratch[i - 1]) distinct++;
+    }
+    return distinct;
+}
+
+// next lexicographic order of a[0..n), false (and a sorted again) after the last
+static inline bool cacheNextPermutation(int* a, int n) {
+    int i = n - 2;
+    while (i >= 0 && a[i] >= a[i + 1]) i--;
+    if (i >= 0) {
+        int j = n - 1;
+        while (a[j] <= a[i]) j--;
+        int tmp = a[i];
+        a[i] = a[j];
+        a[j] = tmp;
+    }
+    for (int l = i + 1, r = n - 1; l < r; l++, r--) {
+        int tmp = a[l];
+        a[l] = a[r];
+        a[r] = tmp;
+    }
+    return i >= 0;
+}
+
+typedef struct CacheColorOrder {
+    uint64_t color;
+    int vertex;
+} CacheColorOrder;
+
+static inline int cacheCompareOrder(const void* a, const void* b) {
+    const CacheColorOrder* x = (const CacheColorOrder*)a;
+    const CacheColorOrder* y = (const CacheColorOrder*)b;
+    if (x->color != y->color) return (x->color > y->color) - (x->color < y->color);
+    return (x->vertex > y->vertex) - (x->vertex < y->vertex);
+}
+
+// Canonical labels of a small graph with normalized, deduplicated edges
+static inline void cacheCanonicalLabels(int n, const Edge* edges, int64_t m, const int64_t* weights, int* label) {
+    int* offsets = (int*)calloc((size_t)n + 1, sizeof(int));
+    int* neighbors = (int*)malloc((2 * (size_t)m + 1) * sizeof(int));
+    uint64_t* color = (uint64_t*)malloc(((size_t)n + 1) * sizeof(uint64_t));
+    uint64_t* next = (uint64_t*)malloc(((size_t)n + 1) * sizeof(uint64_t));
+    uint64_t* scratch = (uint64_t*)malloc(((size_t)n + 1) * sizeof(uint64_t));
+    CacheColorOrder* order = (CacheColorOrder*)malloc(((size_t)n + 1) * sizeof(CacheColorOrder));
+    if (!offsets || !neighbors || !color || !next || !scratch || !order) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int64_t i = 0; i < m; i++) {
+        offsets[edges[i].u + 1]++;
+        if (edges[i].v != edges[i].u) offsets[edges[i].v + 1]++;
+    }
+    for (int v = 0; v < n; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    int* cursor = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    if (!cursor) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(cursor, offsets, (size_t)n * sizeof(int));
+    for (int64_t i = 0; i < m; i++) {
+        neighbors[cursor[edges[i].u]++] = edges[i].v;
+        if (edges[i].v != edges[i].u) neighbors[cursor[edges[i].v]++] = edges[i].u;
+    }
+    free(cursor);
+
+    // color refinement: a vertex's color hashes its old color and the sorted colors around it
+    for (int v = 0; v < n; v++) {
+        color[v] = cacheMix((uint64_t)(offsets[v + 1] - offsets[v]), weights ? (uint64_t)weights[v] : 1);
+    }
+    int classes = cacheCountColors(color, n, scratch);
+    for (int round = 0; round < n; round++) {
+        for (int v = 0; v < n; v++) {
+            int degree = offsets[v + 1] - offsets[v];
+            for (int i = 0; i < degree; i++) {
+                scratch[i] = color[neighbors[offsets[v] + i]];
+            }
+            qsort(scratch, degree, sizeof(uint64_t), cacheCompareColors);
+            uint64_t h = cacheMix(color[v], (uint64_t)degree);
+            for (int i = 0; i < degree; i++) {
+                h = cacheMix(h, scratch[i]);
+            }
+            next[v] = h;
+        }
+        memcpy(color, next, (size_t)n * sizeof(uint64_t));
+        int refined = cacheCountColors(color, n, scratch);
+        if (refined <= classes) break;
+        classes = refined;
+    }
+
+    for (int v = 0; v < n; v++) {
+        order[v].color = color[v];
+        order[v].vertex = v;
+    }
+    qsort(order, n, sizeof(CacheColorOrder), cacheCompareOrder);
+    int* vertices = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    int* classStart = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    if (!vertices || !classStart) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int numClasses = 0;
+    double orders = 1;
+    for (int i = 0; i < n; i++) {
+        vertices[i] = order[i].vertex;
+        if (i == 0 || order[i].color != order[i - 1].color) classStart[numClasses++] = i;
+        orders *= i + 1 - classStart[numClasses - 1];
+    }
+    classStart[numClasses] = n;
+    for (int i = 0; i < n; i++) {
+        label[vertices[i]] = i;
+    }
+
+    // try every order of the tied vertices when there are few, keep the smallest edge list
+    if (orders > 1 && orders <= CACHE_PERMUTATION_BUDGET) {
+        Edge* best = (Edge*)malloc(((size_t)m + 1) * sizeof(Edge));
+        Edge* trial = (Edge*)malloc(((size_t)m + 1) * sizeof(Edge));
+        int* bestLabel = (int*)malloc(((size_t)n + 1) * sizeof(int));
+        if (!best || !trial || !bestLabel) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        cacheRelabel(edges, m, label, best);
+        memcpy(bestLabel, label, (size_t)n * sizeof(int));
+        while (true) {
+            int c = numClasses - 1;
+            while (c >= 0 && !cacheNextPermutation(vertices + classStart[c], classStart[c + 1] - classStart[c])) c--;
+            if (c < 0) break;
+            for (int i = 0; i < n; i++) {
+                label[vertices[i]] = i;
+            }
+            cacheRelabel(edges, m, label, trial);
+            if (memcmp(trial, best, (size_t)m * sizeof(Edge)) < 0) {
+                memcpy(best, trial, (size_t)m * sizeof(Edge));
+                memcpy(bestLabel, label, (size_t)n * sizeof(int));
+            }
+        }
+        memcpy(label, bestLabel, (size_t)n * sizeof(int));
+        free(best);
+        free(trial);
+        free(bestLabel);
+    }
+
+    free(vertices);
+    free(classStart);
+    free(order);
+    free(scratch);
+    free(next);
+    free(color);
+    free(neighbors);
+    free(offsets);
+}
+
+// Normalized key of graph, relabelled canonically when canonical is set and the graph is small
+static inline CacheKey* cacheKey(const Graph* graph, bool canonical) {
+    int n = graph->numVertices;
+    CacheKey* key = (CacheKey*)malloc(sizeof(CacheKey));
+    Edge* normalized = (Edge*)malloc(((size_t)graph->numEdges + 1) * sizeof(Edge));
+    if (!key || !normalized) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    key->numVertices = n;
+    key->label = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    key->edges = (Edge*)malloc(((size_t)graph->numEdges + 1) * sizeof(Edge));
+    key->weights = graph->weights ? (int64_t*)malloc(((size_t)n + 1) * sizeof(int64_t)) : NULL;
+    if (!key->label || !key->edges || (graph->weights && !key->weights)) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int v = 0; v < n; v++) {
+        key->label[v] = v;
+    }
+    cacheRelabel(graph->edges, graph->numEdges, key->label, normalized);
+    int64_t m = 0;
+    for (int64_t i = 0; i < graph->numEdges; i++) {
+        if (m == 0 || cacheCompareEdges(&normalized[i], &normalized[m - 1]) != 0) normalized[m++] = normalized[i];
+    }
+    key->numEdges = m;
+
+    if (canonical && n <= CACHE_CANONICAL_VERTICES) {
+        cacheCanonicalLabels(n, normalized, m, graph->weights, key->label);
+        cacheRelabel(normalized, m, key->label, key->edges);
+    } else {
+        memcpy(key->edges, normalized, (size_t)m * sizeof(Edge));
+    }
+    free(normalized);
+
+    uint64_t h = cacheMix((uint64_t)n, (uint64_t)m);
+    for (int64_t i = 0; i < m; i++) {
+        h = cacheMix(h, (uint64_t)(uint32_t)key->edges[i].u << 32 | (uint32_t)key->edges[i].v);
+    }
+    if (key->weights) {
+        for (int v = 0; v < n; v++) {
+            key->weights[key->label[v]] = graph->weights[v];
+        }
+        for (int v = 0; v < n; v++) {
+            h = cacheMix(h, (uint64_t)key->weights[v]);
+        }
+    }
+    key->hash = h;
+    return key;
+}
+
+static inline void freeCacheKey(CacheKey* key) {
+    free(key->edges);
+    free(key->weights);
+    free(key->label);
+    free(key);
+}
+
+// --- records ---
+
+static inline uint64_t cacheRecordBytes(int64_t numVertices, int64_t numEdges, bool weighted) {
+    return sizeof(CacheRecord) + (uint64_t)numEdges * sizeof(Edge) +
+           (weighted ? (uint64_t)numVertices * sizeof(int64_t) : 0) + (uint64_t)((numVertices + 63) / 64) * sizeof(uint64_t);
+}
+
+// true if the record and its arrays describe key and solver
+static inline bool cacheMatches(const CacheRecord* record, const Edge* edges, const int64_t* weights, const CacheKey* key,
+                                const char* solver) {
+    return record->hash == key->hash && record->numVertices == key->numVertices && record->numEdges == key->numEdges &&
+           record->weighted == (key->weights != NULL) && strncmp(record->solver, solver, CACHE_SOLVER_NAME) == 0 &&
+           memcmp(edges, key->edges, (size_t)key->numEdges * sizeof(Edge)) == 0 &&
+           (!key->weights || memcmp(weights, key->weights, (size_t)key->numVertices * sizeof(int64_t)) == 0);
+}
+
+// cover of the original graph from canonical bits
+static inline bool* cacheCover(const CacheKey* key, const uint64_t* bits) {
+    bool* cover = (bool*)calloc((size_t)key->numVertices + 1, sizeof(bool));
+    if (!cover) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < key->numVertices; v++) {
+        int c = key->label[v];
+        cover[v] = (bits[c >> 6] >> (c & 63)) & 1;
+    }
+    return cover;
+}
+
+// --- memory tier ---
+
+static inline void cacheUnlink(ResultCache* cache, CacheEntry* entry) {
+    if (entry->prev) entry->prev->next = entry->next;
+    else cache->head = entry->next;
+    if (entry->next) entry->next->prev = entry->prev;
+    else cache->tail = entry->prev;
+}
+
+static inline void cachePushFront(ResultCache* cache, CacheEntry* entry) {
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if (cache->head) cache->head->prev = entry;
+    cache->head = entry;
+    if (!cache->tail) cache->tail = entry;
+}
+
+static inline void cacheEvict(ResultCache* cache) {
+    CacheEntry* victim = cache->tail;
+    cacheUnlink(cache, victim);
+    CacheEntry** link = &cache->buckets[victim->record.hash & cache->bucketMask];
+    while (*link != victim) link = &(*link)->chain;
+    *link = victim->chain;
+    cache->bytes -= sizeof(CacheEntry) + victim->record.recordBytes - sizeof(CacheRecord);
+    free(victim);
+    cache->count--;
+}
+
+// Copy a record into a new memory entry, bits in canonical labels. Records
+// larger than the whole memory tier are not kept and give NULL.
+static inline CacheEntry* cacheInsert(ResultCache* cache, const CacheRecord* record, const Edge* edges,
+                                      const int64_t* weights, const uint64_t* bits) {
+    uint64_t bytes = record->recordBytes - sizeof(CacheRecord);
+    if (sizeof(CacheEntry) + bytes > cache->maxBytes) return NULL;
+    CacheEntry* entry = (CacheEntry*)malloc(sizeof(CacheEntry) + bytes);
+    if (!entry) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    entry->record = *record;
+    char* data = (char*)(entry + 1);
+    entry->edges = (Edge*)data;
+    data += (size_t)record->numEdges * sizeof(Edge);
+    entry->weights = record->weighted ? (int64_t*)data : NULL;
+    if (record->weighted) data += (size_t)record->numVertices * sizeof(int64_t);
+    entry->bits = (uint64_t*)data;
+    memcpy(entry->edges, edges, (size_t)record->numEdges * sizeof(Edge));
+    if (record->weighted) memcpy(entry->weights, weights, (size_t)record->numVertices * sizeof(int64_t));
+    memcpy(entry->bits, bits, (size_t)((record->numVertices + 63) / 64) * sizeof(uint64_t));
+
+    CacheEntry** bucket = &cache->buckets[record->hash & cache->bucketMask];
+    entry->chain = *bucket;
+    *bucket = entry;
+    cachePushFront(cache, entry);
+    cache->count++;
+    cache->bytes += sizeof(CacheEntry) + bytes;
+    while (cache->count > cache->capacity || cache->bytes > cache->maxBytes) cacheEvict(cache);
+    return entry;
+}
+
+// --- disk tier ---
+
+static inline void cacheIndexPut(uint64_t* hashes, uint64_t* offsets, uint64_t mask, uint64_t hash, uint64_t offset) {
+    uint64_t i = hash & mask;
+    while (offsets[i] != 0) i = (i + 1) & mask;
+    hashes[i] = hash;
+    offsets[i] = offset;
+}
+
+// Index the record at offset, the table doubles when it gets half full
+static inline void cacheIndexAdd(ResultCache* cache, uint64_t hash, uint64_t offset) {
+    uint64_t slots = cache->indexMask + 1;
+    if (2 * (cache->indexCount + 1) > slots) {
+        uint64_t* hashes = (uint64_t*)calloc(2 * slots, sizeof(uint64_t));
+        uint64_t* offsets = (uint64_t*)calloc(2 * slots, sizeof(uint64_t));
+        if (!hashes || !offsets) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        for (uint64_t i = 0; i < slots; i++) {
+            if (cache->indexOffsets[i] != 0) {
+                cacheIndexPut(hashes, offsets, 2 * slots - 1, cache->indexHashes[i], cache->indexOffsets[i]);
+            }
+        }
+        free(cache->indexHashes);
+        free(cache->indexOffsets);
+        cache->indexHashes = hashes;
+        cache->indexOffsets = offsets;
+        cache->indexMask = 2 * slots - 1;
+    }
+    cacheIndexPut(cache->indexHashes, cache->indexOffsets, cache->indexMask, hash, offset);
+    cache->indexCount++;
+}
+
+// Map the file again after appends, the index stays as it is
+static inline bool cacheRemap(ResultCache* cache) {
+    if (cache->fileMapped) unmapFile(&cache->file);
+    cache->fileMapped = false;
+    if (cache->append) fflush(cache->append);
+    if (!mapFile(cache->path, &cache->file)) return false;
+    cache->fileMapped = true;
+    return true;
+}
+
+// Map the file and index every complete record in it
+static inline bool cacheIndexFile(ResultCache* cache) {
+    if (!cacheRemap(cache)) return false;
+
+    const char* data = cache->file.data;
+    size_t size = cache->file.size;
+    const CacheFileHeader* header = (const CacheFileHeader*)data;
+    if (size < sizeof(CacheFileHeader) || memcmp(header->magic, CACHE_MAGIC, sizeof(header->magic)) != 0) {
+        fprintf(stderr, "%s: not a result cache\n", cache->path);
+        return false;
+    }
+    if (header->version != CACHE_VERSION || header->byteOrder != CACHE_BYTE_ORDER) {
+        fprintf(stderr, "%s: result cache from another version or byte order\n", cache->path);
+        return false;
+    }
+
+    // count the records, a torn record at the end (an interrupted write) is ignored
+    int64_t records = 0;
+    uint64_t pos = sizeof(CacheFileHeader);
+    while (pos + sizeof(CacheRecord) <= size) {
+        const CacheRecord* record = (const CacheRecord*)(data + pos);
+        if (record->numVertices < 0 || record->numEdges < 0 ||
+            record->recordBytes != cacheRecordBytes(record->numVertices, record->numEdges, record->weighted) ||
+            record->recordBytes > size - pos) {
+            break;
+        }
+        records++;
+        pos += record->recordBytes;
+    }
+    cache->validBytes = pos;
+    uint64_t slots = 16;
+    while (slots < 2 * (uint64_t)records) slots *= 2;
+    cache->indexMask = slots - 1;
+    cache->indexCount = 0;
+    cache->indexHashes = (uint64_t*)calloc(slots, sizeof(uint64_t));
+    cache->indexOffsets = (uint64_t*)calloc(slots, sizeof(uint64_t));
+    if (!cache->indexHashes || !cache->indexOffsets) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    pos = sizeof(CacheFileHeader);
+    for (int64_t r = 0; r < records; r++) {
+        const CacheRecord* record = (const CacheRecord*)(data + pos);
+        cacheIndexAdd(cache, record->hash, pos);
+        pos += record->recordBytes;
+    }
+    return true;
+}
+
+// Record for key and solver in the file, or NULL. Records appended after the
+// file was mapped are reached by mapping it again.
+static inline const CacheRecord* cacheFindOnDisk(ResultCache* cache, const CacheKey* key, const char* solver) {
+    if (!cache->indexOffsets) return NULL;
+    for (uint64_t i = key->hash & cache->indexMask; cache->indexOffsets[i] != 0; i = (i + 1) & cache->indexMask) {
+        if (cache->indexHashes[i] != key->hash) continue;
+        if (!cache->fileMapped || cache->indexOffsets[i] + sizeof(CacheRecord) > cache->file.size) {
+            if (!cacheRemap(cache) || cache->indexOffsets[i] + sizeof(CacheRecord) > cache->file.size) return NULL;
+        }
+        const CacheRecord* record = (const CacheRecord*)(cache->file.data + cache->indexOffsets[i]);
+        const Edge* edges = (const Edge*)(record + 1);
+        const int64_t* weights = (const int64_t*)(edges + record->numEdges);
+        if (cacheMatches(record, edges, weights, key, solver)) return record;
+    }
+    return NULL;
+}
+
+// --- interface ---
+
+static inline void closeResultCache(ResultCache* cache) {
+    while (cache->head) {
+        CacheEntry* next = cache->head->next;
+        free(cache->head);
+        cache->head = next;
+    }
+    if (cache->append) fclose(cache->append);
+    if (cache->fileMapped) unmapFile(&cache->file);
+    free(cache->indexHashes);
+    free(cache->indexOffsets);
+    free(cache->path);
+    free(cache->buckets);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache);
+}
+
+// Cache of at most capacity entries in memory, backed by the file at path
+// when path is not NULL (created if missing). Returns NULL after printing a
+// message if path cannot be used.
+static inline ResultCache* openResultCache(int capacity, const char* path) {
+    ResultCache* cache = (ResultCache*)calloc(1, sizeof(ResultCache));
+    if (!cache) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    pthread_mutex_init(&cache->lock, NULL);
+    cache->capacity = capacity > 0 ? capacity : 1;
+    cache->maxBytes = CACHE_MEMORY_BYTES;
+    uint64_t buckets = 16;
+    while (buckets < (uint64_t)cache->capacity) buckets *= 2;
+    cache->bucketMask = buckets - 1;
+    cache->buckets = (CacheEntry**)calloc(buckets, sizeof(CacheEntry*));
+    if (!cache->buckets) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    if (path == NULL) return cache;
+
+    cache->path = strdup(path);
+    FILE* existing = fopen(path, "rb");
+    if (existing) {
+        fclose(existing);
+    } else {
+        CacheFileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+        header.version = CACHE_VERSION;
+        header.byteOrder = CACHE_BYTE_ORDER;
+        FILE* fp = fopen(path, "wb");
+        if (!fp || fwrite(&header, sizeof(header), 1, fp) != 1) {
+            perror(path);
+            if (fp) fclose(fp);
+            closeResultCache(cache);
+            return NULL;
+        }
+        fclose(fp);
+    }
+
+    if (!cacheIndexFile(cache)) {
+        closeResultCache(cache);
+        return NULL;
+    }
+#ifndef GRAPH_LOADER_NO_MMAP
+    // drop a torn record so new records are appended where the index can reach them
+    if (cache->validBytes < cache->file.size) {
+        if (truncate(path, (off_t)cache->validBytes) != 0) perror(path);
+        cacheRemap(cache);
+    }
+#endif
+    cache->append = fopen(path, "ab");
+    if (!cache->append) {
+        perror(path);
+        closeResultCache(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+// Cover stored for key and solver in the original labels, or NULL on a miss.
+// size (if not NULL) gets the cover size.
+static inline bool* cacheLookup(ResultCache* cache, const CacheKey* key, const char* solver, int* size) {
+    pthread_mutex_lock(&cache->lock);
+    CacheEntry* entry = cache->buckets[key->hash & cache->bucketMask];
+    while (entry && !cacheMatches(&entry->record, entry->edges, entry->weights, key, solver)) {
+        entry = entry->chain;
+    }
+    bool* cover = NULL;
+    if (entry) {
+        cacheUnlink(cache, entry);
+        cachePushFront(cache, entry);
+        cover = cacheCover(key, entry->bits);
+        if (size) *size = entry->record.size;
+        cache->hits++;
+    } else if (cache->path) {
+        const CacheRecord* record = cacheFindOnDisk(cache, key, solver);
+        if (record) {
+            const Edge* edges = (const Edge*)(record + 1);
+            const int64_t* weights = (const int64_t*)(edges + record->numEdges);
+            const uint64_t* bits = (const uint64_t*)(weights + (record->weighted ? record->numVertices : 0));
+            cover = cacheCover(key, bits);
+            if (size) *size = record->size;
+            cacheInsert(cache, record, edges, weights, bits);
+            cache->hits++;
+            cache->diskHits++;
+        }
+    }
+    if (!cover) cache->misses++;
+    pthread_mutex_unlock(&cache->lock);
+    return cover;
+}
+
+// Remember cover as the result of solver on key, on disk too when the cache has a file
+static inline void cacheStore(ResultCache* cache, const CacheKey* key, const char* solver, const bool* cover) {
+    int n = key->numVertices;
+    int64_t words = (n + 63) / 64;
+    uint64_t* bits = (uint64_t*)calloc((size_t)words + 1, sizeof(uint64_t));
+    if (!bits) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    CacheRecord record;
+    memset(&record, 0, sizeof(record));
+    for (int v = 0; v < n; v++) {
+        if (!cover[v]) continue;
+        int c = key->label[v];
+        bits[c >> 6] |= (uint64_t)1 << (c & 63);
+        record.size++;
+    }
+    record.recordBytes = cacheRecordBytes(n, key->numEdges, key->weights != NULL);
+    record.hash = key->hash;
+    record.numEdges = key->numEdges;
+    record.numVertices = n;
+    record.weighted = key->weights != NULL;
+    strncpy(record.solver, solver, CACHE_SOLVER_NAME - 1);
+
+    pthread_mutex_lock(&cache->lock);
+    CacheEntry* entry = cache->buckets[key->hash & cache->bucketMask];
+    while (entry && !cacheMatches(&entry->record, entry->edges, entry->weights, key, solver)) {
+        entry = entry->chain;
+    }
+    if (!entry) {
+        cacheInsert(cache, &record, key->edges, key->weights, bits);
+        if (cache->append) {
+            bool ok = fwrite(&record, sizeof(record), 1, cache->append) == 1 &&
+                      fwrite(key->edges, sizeof(Edge), key->numEdges, cache->append) == (size_t)key->numEdges &&
+                      (!key->weights || fwrite(key->weights, sizeof(int64_t), n, cache->append) == (size_t)n) &&
+                      fwrite(bits, sizeof(uint64_t), words, cache->append) == (size_t)words;
+            if (!ok || fflush(cache->append) != 0) {
+                perror(cache->path);
+                fclose(cache->append);
+                cache->append = NULL;
+            } else {
+                cacheIndexAdd(cache, record.hash, cache->validBytes);
+                cache->validBytes += record.recordBytes;
+            }
+        }
+    }
+    pthread_mutex_unlock(&cache->lock);
+    free(bits);
+}
+
+#endif
@@ -1,194 +1,1227 @@
-//Dynamic Program Version
-// Minimum Vertex Cover
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <limits.h>
-#include <time.h>
-
-//node structure for tree repres.
-typedef struct Node{
-    int data;
-    struct Node *left, *right;
-}Node;
-
-// new tree node
-Node* newNode(int data){
-    Node* node = (Node*)malloc(sizeof(Node));
-    node->data = data;
-    node->left = node->right = NULL; 
-    return node;
-}
-
-// helper to calculate vertex cover size
-void vertexCover(Node* root, int* include, int* exclude){
-    if(!root){
-        *include = 0;
-        *exclude = 0;
-        return;
-    }
-
-    //stores results from subtrees
-    int left_include, left_exclude;
-    int right_include, right_exclude;
-
-    //calculate for right and left subtrees recursively
-    vertexCover(root->left, &left_include, &left_exclude);
-    vertexCover(root->right, &right_include, &right_exclude);
-
-    //including the current node in vertex cover
-    *include = 1 + (left_include < left_exclude ? left_include : left_exclude) // min of left
-             + (right_include < right_exclude ? right_include : right_exclude); // min of right
-
-    //excluding the current node in vertex cover
-    *exclude = left_include + right_include;
-}
-
-//main function to compute min vertex cover
-int minVertexCover(Node* root) {
-    int include, exclude;
-
-    vertexCover(root, &include, &exclude);
-
-    //return the smaller
-    return (include < exclude) ? include : exclude;
-}
-
-// Free the memory allocated for the tree
-void freeTree(Node* root) {
-    if (root) {
-        freeTree(root->left);
-        freeTree(root->right);
-        free(root);
-    }
-}
-
-// Function to create graph351 as a tree
-Node* createGraph351Tree() {
-    // Create tree representation of graph351
-
-    Node* root = newNode(0);  // A
-    root->left = newNode(1);  // B
-    root->left->left = newNode(2);  // C
-    root->left->left->left = newNode(3);  // D
-    root->left->left->left->left = newNode(5);  // F
-    root->left->left->left->right = newNode(6);  // G
-    root->left->left->right = newNode(4);  // E
-    root->left->left->right->left = newNode(5);  // F (duplicate)
-    
-    return root;
-}
-
-// Function to create graphConnected as a tree
-Node* createGraphConnectedTree() {
-    // approximation only
-    Node* root = newNode(0);  // A
-    root->left = newNode(1);  // B
-    root->right = newNode(2);  // C
-    root->left->left = newNode(3);  // D
-    root->left->right = newNode(4);  // E
-    root->right->left = newNode(5);  // F
-    root->right->right = newNode(6);  // G
-    
-    return root;
-}
-
-// Function to create graphBipartite as a tree
-Node* createGraphBipartiteTree() {
-    // approximation only
-    Node* root = newNode(0);  // A
-    
-    // First level - left side of bipartite graph
-    root->left = newNode(1);  // B
-    root->right = newNode(2);  // C
-    
-    // Second level
-    root->left->left = newNode(3);  // D
-    root->left->right = newNode(4);  // E
-    root->right->left = newNode(5);  // F
-    root->right->right = newNode(6);  // G
-    
-    // Third level
-    root->left->left->left = newNode(7);  // H
-    root->left->right->left = newNode(8);  // I
-    root->right->left->left = newNode(9);  // J
-    
-    return root;
-}
-
-// Function to create graphBig as a tree
-Node* createGraphBigTree() {
-    // approximation only
-    Node* root = newNode(0);  // A
-    
-    // Level 1
-    root->left = newNode(1);  // B
-    root->right = newNode(2);  // C
-    
-    // Level 2
-    root->left->left = newNode(3);  // D
-    root->left->right = newNode(4);  // E
-    root->right->left = newNode(5);  // F
-    root->right->right = newNode(6);  // G
-    
-    // Level 3
-    root->left->left->left = newNode(7);  // H
-    root->left->left->right = newNode(8);  // I
-    root->left->right->left = newNode(9);  // J
-    root->left->right->right = newNode(10);  // K
-    root->right->left->left = newNode(11);  // L
-    root->right->left->right = newNode(12);  // M
-    root->right->right->left = newNode(13);  // N
-    root->right->right->right = newNode(14);  // O
-    
-    // Level 4
-    root->left->left->left->left = newNode(15);  // P
-    root->left->left->left->right = newNode(16);  // Q
-    root->left->left->right->left = newNode(17);  // R
-    root->left->left->right->right = newNode(18);  // S
-    root->left->right->left->left = newNode(19);  // T
-    root->left->right->left->right = newNode(20);  // U
-    
-    return root;
-}
-
-// Function to time a test
-double timeTest(Node* (*createTreeFunc)(), const char* graphName) {
-    clock_t start, end;
-    double cpu_time_used;
-    
-    start = clock();
-    
-    Node* root = createTreeFunc();
-    int minCover = minVertexCover(root);
-    printf("Minimum Vertex Cover Size for %s: %d\n", graphName, minCover);
-    freeTree(root);
-    
-    end = clock();
-    
-    cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
-    return cpu_time_used;
-}
-
-//main program
-int main() {
-    double time_used;
-    
-    printf("Testing graph351...\n");
-    time_used = timeTest(createGraph351Tree, "graph351");
-    printf("Time taken for graph351: %.6f seconds\n\n", time_used);
-    
-    printf("Testing graphConnected...\n");
-    time_used = timeTest(createGraphConnectedTree, "graphConnected");
-    printf("Time taken for graphConnected: %.6f seconds\n\n", time_used);
-    
-    printf("Testing graphBipartite...\n");
-    time_used = timeTest(createGraphBipartiteTree, "graphBipartite");
-    printf("Time taken for graphBipartite: %.6f seconds\n\n", time_used);
-    
-    printf("Testing graphBig...\n");
-    time_used = timeTest(createGraphBigTree, "graphBig");
-    printf("Time taken for graphBig: %.6f seconds\n", time_used);
-    
-    return 0;
+//Dynamic Program Version
+// Minimum Vertex Cover
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "graph.h"
+#include "graphCSR.h"
+#include "benchmark.h"
+
+//node structure for tree repres.
+typedef struct Node{
+    int data;
+    struct Node *left, *right;
+}Node;
+
+// new tree node
+Node* newNode(int data){
+    Node* node = (Node*)malloc(sizeof(Node));
+    node->data = data;
+    node->left = node->right = NULL; 
+    return node;
+}
+
+// helper to calculate vertex cover cost, weights[data] is the cost of a node
+// (NULL counts every node as 1)
+void vertexCover(Node* root, const int64_t* weights, int64_t* include, int64_t* exclude){
+    if(!root){
+        *include = 0;
+        *exclude = 0;
+        return;
+    }
+
+    //stores results from subtrees
+    int64_t left_include, left_exclude;
+    int64_t right_include, right_exclude;
+
+    //calculate for right and left subtrees recursively
+    vertexCover(root->left, weights, &left_include, &left_exclude);
+    vertexCover(root->right, weights, &right_include, &right_exclude);
+
+    //including the current node in vertex cover
+    *include = (weights ? weights[root->data] : 1) + (left_include < left_exclude ? left_include : left_exclude) // min of left
+             + (right_include < right_exclude ? right_include : right_exclude); // min of right
+
+    //excluding the current node in vertex cover
+    *exclude = left_include + right_include;
+}
+
+//main function to compute min vertex cover
+int64_t minVertexCover(Node* root, const int64_t* weights) {
+    int64_t include, exclude;
+
+    vertexCover(root, weights, &include, &exclude);
+
+    //return the smaller
+    return (include < exclude) ? include : exclude;
+}
+
+// Free the memory allocated for the tree
+void freeTree(Node* root) {
+    if (root) {
+        freeTree(root->left);
+        freeTree(root->right);
+        free(root);
+    }
+}
+
+// Function to create graph351 as a tree
+Node* createGraph351Tree() {
+    // Create tree representation of graph351
+
+    Node* root = newNode(0);  // A
+    root->left = newNode(1);  // B
+    root->left->left = newNode(2);  // C
+    root->left->left->left = newNode(3);  // D
+    root->left->left->left->left = newNode(5);  // F
+    root->left->left->left->right = newNode(6);  // G
+    root->left->left->right = newNode(4);  // E
+    root->left->left->right->left = newNode(5);  // F (duplicate)
+    
+    return root;
+}
+
+// Function to create graphConnected as a tree
+Node* createGraphConnectedTree() {
+    // approximation only
+    Node* root = newNode(0);  // A
+    root->left = newNode(1);  // B
+    root->right = newNode(2);  // C
+    root->left->left = newNode(3);  // D
+    root->left->right = newNode(4);  // E
+    root->right->left = newNode(5);  // F
+    root->right->right = newNode(6);  // G
+    
+    return root;
+}
+
+// Function to create graphBipartite as a tree
+Node* createGraphBipartiteTree() {
+    // approximation only
+    Node* root = newNode(0);  // A
+    
+    // First level - left side of bipartite graph
+    root->left = newNode(1);  // B
+    root->right = newNode(2);  // C
+    
+    // Second level
+    root->left->left = newNode(3);  // D
+    root->left->right = newNode(4);  // E
+    root->right->left = newNode(5);  // F
+    root->right->right = newNode(6);  // G
+    
+    // Third level
+    root->left->left->left = newNode(7);  // H
+    root->left->right->left = newNode(8);  // I
+    root->right->left->left = newNode(9);  // J
+    
+    return root;
+}
+
+// Function to create graphBig as a tree
+Node* createGraphBigTree() {
+    // approximation only
+    Node* root = newNode(0);  // A
+    
+    // Level 1
+    root->left = newNode(1);  // B
+    root->right = newNode(2);  // C
+    
+    // Level 2
+    root->left->left = newNode(3);  // D
+    root->left->right = newNode(4);  // E
+    root->right->left = newNode(5);  // F
+    root->right->right = newNode(6);  // G
+    
+    // Level 3
+    root->left->left->left = newNode(7);  // H
+    root->left->left->right = newNode(8);  // I
+    root->left->right->left = newNode(9);  // J
+    root->left->right->right = newNode(10);  // K
+    root->right->left->left = newNode(11);  // L
+    root->right->left->right = newNode(12);  // M
+    root->right->right->left = newNode(13);  // N
+    root->right->right->right = newNode(14);  // O
+    
+    // Level 4
+    root->left->left->left->left = newNode(15);  // P
+    root->left->left->left->right = newNode(16);  // Q
+    root->left->left->right->left = newNode(17);  // R
+    root->left->left->right->right = newNode(18);  // S
+    root->left->right->left->left = newNode(19);  // T
+    root->left->right->left->right = newNode(20);  // U
+    
+    return root;
+}
+
+// Forest laid out in BFS order as flat arrays.
+// Positions 0..n-1 follow the BFS, the children of position i are the
+// childCount[i] consecutive positions starting at firstChild[i], so any fan-out
+// is allowed and the DP below is two loops over the arrays with no recursion.
+typedef struct Forest {
+    int numVertices;
+    int* order;       // BFS position -> vertex
+    int* parent;      // BFS position -> parent position, -1 for roots
+    int* firstChild;
+    int* childCount;
+} Forest;
+
+void freeForest(Forest* forest) {
+    free(forest->order);
+    free(forest->parent);
+    free(forest->firstChild);
+    free(forest->childCount);
+    free(forest);
+}
+
+// Lay out an edge list graph as a forest, returns NULL if it has a cycle.
+// Repeated copies of an edge are not treated as a cycle.
+Forest* buildForest(Graph* graph) {
+    int n = graph->numVertices;
+
+    int* position = (int*)malloc((n + 1) * sizeof(int));
+    Forest* forest = (Forest*)malloc(sizeof(Forest));
+    if (!position || !forest) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    forest->numVertices = n;
+    forest->order = (int*)malloc((n + 1) * sizeof(int));
+    forest->parent = (int*)malloc((n + 1) * sizeof(int));
+    forest->firstChild = (int*)malloc((n + 1) * sizeof(int));
+    forest->childCount = (int*)malloc((n + 1) * sizeof(int));
+    if (!forest->order || !forest->parent || !forest->firstChild || !forest->childCount) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    CSRGraph* csr = buildNeighborCSR(graph);
+    for (int v = 0; v < n; v++) {
+        position[v] = -1;
+    }
+
+    // BFS from every unvisited vertex, the queue is the order array itself
+    bool isForest = true;
+    int tail = 0;
+    for (int root = 0; root < n && isForest; root++) {
+        if (position[root] != -1) continue;
+        position[root] = tail;
+        forest->parent[tail] = -1;
+        forest->order[tail++] = root;
+
+        for (int head = position[root]; head < tail && isForest; head++) {
+            int v = forest->order[head];
+            forest->firstChild[head] = tail;
+            int parentVertex = forest->parent[head] == -1 ? -1 : forest->order[forest->parent[head]];
+            for (int64_t i = csr->offsets[v]; i < csr->offsets[v + 1]; i++) {
+                int w = csr->neighbors[i];
+                if (position[w] == -1) {
+                    position[w] = tail;
+                    forest->parent[tail] = head;
+                    forest->order[tail++] = w;
+                } else if (w != parentVertex && forest->parent[position[w]] != head) {
+                    isForest = false; // an edge back into the tree closes a cycle
+                    break;
+                }
+            }
+            forest->childCount[head] = tail - forest->firstChild[head];
+        }
+    }
+
+    freeCSR(csr);
+    free(position);
+    if (!isForest) {
+        freeForest(forest);
+        return NULL;
+    }
+    return forest;
+}
+
+// Include/exclude DP bottom up over the BFS layout, then the choices are
+// replayed top down to recover the cover. weights are the vertex costs (NULL
+// for unit costs). Fills cover by vertex id, returns its cost.
+int64_t forestVertexCover(Forest* forest, const int64_t* weights, bool* cover) {
+    int n = forest->numVertices;
+    int64_t* include = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    int64_t* exclude = (int64_t*)malloc((n + 1) * sizeof(int64_t));
+    bool* taken = (bool*)malloc((n + 1) * sizeof(bool));
+    if (!include || !exclude || !taken) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
+    INSTR_COUNT(INSTR_NODES, n);
+
+    // children always come after their parent, so walk the positions backwards
+    for (int i = n - 1; i >= 0; i--) {
+        int64_t inc = weights ? weights[forest->order[i]] : 1, exc = 0;
+        int end = forest->firstChild[i] + forest->childCount[i];
+        for (int c = forest->firstChild[i]; c < end; c++) {
+            inc += include[c] < exclude[c] ? include[c] : exclude[c];
+            exc += include[c];
+        }
+        include[i] = inc;
+        exclude[i] = exc;
+    }
+
+    int64_t cost = 0;
+    for (int i = 0; i < n; i++) {
+        int p = forest->parent[i];
+        if (p != -1 && !taken[p]) {
+            taken[i] = true; // the edge to an excluded parent needs this vertex
+        } else {
+            taken[i] = include[i] < exclude[i];
+        }
+        cover[forest->order[i]] = taken[i];
+        if (taken[i]) cost += weights ? weights[forest->order[i]] : 1;
+    }
+
+    free(include);
+    free(exclude);
+    free(taken);
+    INSTR_PHASE_END(PHASE_SOLVE);
+    return cost;
+}
+
+// Tree decomposition DP for graphs of small treewidth.
+// An elimination order gives one bag per vertex v: v plus its neighbors
+// N+(v) at the time it is eliminated (fill edges included). The parent of
+// the bag is the vertex of N+(v) eliminated next, and N+(v) is contained in
+// the parent's bag, so every bag is processed like a nice tree decomposition:
+// the child tables are joined (summed) over the parent's bag, v is introduced
+// with the original edges from v into N+(v) checked, and v is then forgotten
+// (min over v in or out). Tables are indexed by bitmasks over N+(v), so a
+// bag of width w needs 2^w entries.
+
+// widths above this are rejected, 2^20 entry tables are the largest we build
+#define MAX_TREEWIDTH 20
+// min fill rescans every remaining vertex per step, only worth it on small graphs
+#define MIN_FILL_LIMIT 500
+// min degree breaks ties by fill among this many candidates
+#define MIN_DEGREE_TIES 8
+
+typedef enum EliminationHeuristic {
+    MIN_DEGREE, // eliminate a vertex of smallest current degree
+    MIN_FILL    // eliminate the vertex that adds the fewest fill edges
+} EliminationHeuristic;
+
+// Result of an elimination, indexed by elimination step.
+// The vertex eliminated at step s is order[s] and its N+ is
+// bag[bagStart[s]] .. bag[bagStart[s + 1] - 1].
+typedef struct Decomposition {
+    int numVertices;
+    int width;
+    int* order;        // step -> vertex
+    int* rank;         // vertex -> step
+    int* bagStart;     // n + 1 entries
+    int* bag;
+    int* parent;       // step of the parent bag, -1 for roots
+    int* originalMask; // bit i set when the i-th vertex of N+ is an original neighbor
+    bool* loop;        // the vertex has a self loop and has to be taken
+} Decomposition;
+
+void freeDecomposition(Decomposition* td) {
+    free(td->order);
+    free(td->rank);
+    free(td->bagStart);
+    free(td->bag);
+    free(td->parent);
+    free(td->originalMask);
+    free(td->loop);
+    free(td);
+}
+
+typedef struct EliminationGraph {
+    int n;
+    int** adj;
+    int* size;
+    int* cap;
+    bool* eliminated;
+    int* mark;
+    int stamp;
+} EliminationGraph;
+
+static void eliminationAppend(EliminationGraph* eg, int v, int w) {
+    if (eg->size[v] == eg->cap[v]) {
+        eg->cap[v] = eg->cap[v] ? 2 * eg->cap[v] : 4;
+        eg->adj[v] = (int*)realloc(eg->adj[v], eg->cap[v] * sizeof(int));
+        if (!eg->adj[v]) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    eg->adj[v][eg->size[v]++] = w;
+}
+
+// drop eliminated vertices from the list of v, returns the current degree
+static int eliminationCompact(EliminationGraph* eg, int v) {
+    int write = 0;
+    for (int i = 0; i < eg->size[v]; i++) {
+        if (!eg->eliminated[eg->adj[v][i]]) {
+            eg->adj[v][write++] = eg->adj[v][i];
+        }
+    }
+    eg->size[v] = write;
+    return write;
+}
+
+// number of fill edges eliminating v would add
+static int fillCount(EliminationGraph* eg, int v) {
+    int fill = 0;
+    int d = eliminationCompact(eg, v);
+    for (int i = 0; i < d; i++) {
+        int a = eg->adj[v][i];
+        eliminationCompact(eg, a);
+        eg->stamp++;
+        for (int j = 0; j < eg->size[a]; j++) {
+            eg->mark[eg->adj[a][j]] = eg->stamp;
+        }
+        for (int j = i + 1; j < d; j++) {
+            if (eg->mark[eg->adj[v][j]] != eg->stamp) fill++;
+        }
+    }
+    return fill;
+}
+
+// Binary min heap of (key, vertex) with lazy deletion, for the min degree order
+typedef struct {
+    int64_t* items; // key << 32 | vertex
+    int size;
+    int cap;
+} EliminationHeap;
+
+static void heapPush(EliminationHeap* heap, int key, int v) {
+    if (heap->size == heap->cap) {
+        heap->cap = heap->cap ? 2 * heap->cap : 64;
+        heap->items = (int64_t*)realloc(heap->items, heap->cap * sizeof(int64_t));
+        if (!heap->items) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    int64_t item = ((int64_t)key << 32) | (uint32_t)v;
+    int i = heap->size++;
+    while (i > 0 && heap->items[(i - 1) / 2] > item) {
+        heap->items[i] = heap->items[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap->items[i] = item;
+}
+
+static int64_t heapPop(EliminationHeap* heap) {
+    int64_t top = heap->items[0];
+    int64_t last = heap->items[--heap->size];
+    int i = 0;
+    while (2 * i + 1 < heap->size) {
+        int c = 2 * i + 1;
+        if (c + 1 < heap->size && heap->items[c + 1] < heap->items[c]) c++;
+        if (heap->items[c] >= last) break;
+        heap->items[i] = heap->items[c];
+        i = c;
+    }
+    heap->items[i] = last;
+    return top;
+}
+
+// Build a tree decomposition from an elimination order chosen by the heuristic.
+// Returns NULL as soon as a bag would be wider than maxWidth.
+Decomposition* buildDecomposition(Graph* graph, EliminationHeuristic heuristic, int maxWidth) {
+    int n = graph->numVertices;
+    EliminationGraph eg;
+    eg.n = n;
+    eg.adj = (int**)calloc(n + 1, sizeof(int*));
+    eg.size = (int*)calloc(n + 1, sizeof(int));
+    eg.cap = (int*)calloc(n + 1, sizeof(int));
+    eg.eliminated = (bool*)calloc(n + 1, sizeof(bool));
+    eg.mark = (int*)calloc(n + 1, sizeof(int));
+    int* original = (int*)calloc(n + 1, sizeof(int)); // stamp of v's original neighbors
+    bool* hasLoop = (bool*)calloc(n + 1, sizeof(bool));
+    Decomposition* td = (Decomposition*)malloc(sizeof(Decomposition));
+    if (!eg.adj || !eg.size || !eg.cap || !eg.eliminated || !eg.mark || !original || !hasLoop || !td) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    eg.stamp = 0;
+
+    td->numVertices = n;
+    td->width = 0;
+    td->order = (int*)malloc((n + 1) * sizeof(int));
+    td->rank = (int*)malloc((n + 1) * sizeof(int));
+    td->bagStart = (int*)malloc((n + 1) * sizeof(int));
+    td->parent = (int*)malloc((n + 1) * sizeof(int));
+    td->originalMask = (int*)calloc(n + 1, sizeof(int));
+    td->loop = (bool*)calloc(n + 1, sizeof(bool));
+    int bagCap = n + 16;
+    td->bag = (int*)malloc(bagCap * sizeof(int));
+    if (!td->order || !td->rank || !td->bagStart || !td->parent || !td->originalMask || !td->loop || !td->bag) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    // simple graph adjacency, repeated edges dropped and self loops kept aside
+    for (int64_t i = 0; i < graph->numEdges; i++) {
+        int u = graph->edges[i].u;
+        int v = graph->edges[i].v;
+        if (u == v) {
+            hasLoop[u] = true;
+            continue;
+        }
+        eliminationAppend(&eg, u, v);
+        eliminationAppend(&eg, v, u);
+    }
+    for (int v = 0; v < n; v++) {
+        eg.stamp++;
+        int write = 0;
+        for (int i = 0; i < eg.size[v]; i++) {
+            int w = eg.adj[v][i];
+            if (eg.mark[w] != eg.stamp) {
+                eg.mark[w] = eg.stamp;
+                eg.adj[v][write++] = w;
+            }
+        }
+        eg.size[v] = write;
+    }
+
+    // the original neighbor lists are needed later, keep a CSR copy
+    int* origStart = (int*)malloc((n + 1) * sizeof(int));
+    int total = 0;
+    for (int v = 0; v < n; v++) total += eg.size[v];
+    int* origAdj = (int*)malloc((total + 1) * sizeof(int));
+    if (!origStart || !origAdj) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    total = 0;
+    for (int v = 0; v < n; v++) {
+        origStart[v] = total;
+        memcpy(origAdj + total, eg.adj[v], eg.size[v] * sizeof(int));
+        total += eg.size[v];
+    }
+    origStart[n] = total;
+
+    EliminationHeap heap = {NULL, 0, 0};
+    if (heuristic == MIN_DEGREE) {
+        for (int v = 0; v < n; v++) heapPush(&heap, eg.size[v], v);
+    }
+
+    bool tooWide = false;
+    int bagSize = 0;
+    for (int step = 0; step < n && !tooWide; step++) {
+        int v = -1;
+        if (heuristic == MIN_DEGREE) {
+            // Take up to MIN_DEGREE_TIES live vertices of the smallest degree and
+            // eliminate the one with the least fill, stale entries whose degree
+            // changed since they were pushed are skipped
+            int ties[MIN_DEGREE_TIES];
+            int numTies = 0;
+            int minKey = -1;
+            while (heap.size > 0 && numTies < MIN_DEGREE_TIES) {
+                int64_t item = heap.items[0];
+                int candidate = (int)(item & 0xffffffff);
+                int key = (int)(item >> 32);
+                if (minKey != -1 && key > minKey) break;
+                heapPop(&heap);
+                if (eg.eliminated[candidate] || key != eliminationCompact(&eg, candidate)) continue;
+                if (numTies > 0 && ties[numTies - 1] == candidate) continue;
+                minKey = key;
+                ties[numTies++] = candidate;
+            }
+            int bestFill = -1;
+            for (int i = 0; i < numTies; i++) {
+                int fill = numTies > 1 ? fillCount(&eg, ties[i]) : 0;
+                if (bestFill == -1 || fill < bestFill) {
+                    bestFill = fill;
+                    v = ties[i];
+                }
+            }
+            for (int i = 0; i < numTies; i++) {
+                if (ties[i] != v) heapPush(&heap, minKey, ties[i]);
+            }
+        } else {
+            int bestFill = -1;
+            for (int u = 0; u < n; u++) {
+                if (eg.eliminated[u]) continue;
+                int fill = fillCount(&eg, u);
+                if (bestFill == -1 || fill < bestFill) {
+                    bestFill = fill;
+                    v = u;
+                    if (fill == 0) break;
+                }
+            }
+        }
+
+        int d = eliminationCompact(&eg, v);
+        if (d > maxWidth) {
+            tooWide = true;
+            break;
+        }
+        if (d > td->width) td->width = d;
+
+        td->order[step] = v;
+        td->rank[v] = step;
+        td->loop[step] = hasLoop[v];
+        td->bagStart[step] = bagSize;
+        if (bagSize + d > bagCap) {
+            bagCap = 2 * (bagSize + d);
+            td->bag = (int*)realloc(td->bag, bagCap * sizeof(int));
+            if (!td->bag) {
+                perror("Memory allocation failed");
+                exit(EXIT_FAILURE);
+            }
+        }
+        memcpy(td->bag + bagSize, eg.adj[v], d * sizeof(int));
+
+        // which members of N+(v) are real neighbors rather than fill
+        eg.stamp++;
+        for (int i = origStart[v]; i < origStart[v + 1]; i++) {
+            original[origAdj[i]] = eg.stamp;
+        }
+        for (int i = 0; i < d; i++) {
+            if (original[td->bag[bagSize + i]] == eg.stamp) {
+                td->originalMask[step] |= 1 << i;
+            }
+        }
+        bagSize += d;
+
+        // turn N+(v) into a clique, then remove v
+        eg.eliminated[v] = true;
+        for (int i = 0; i < d; i++) {
+            int a = eg.adj[v][i];
+            eliminationCompact(&eg, a);
+            eg.stamp++;
+            for (int j = 0; j < eg.size[a]; j++) {
+                eg.mark[eg.adj[a][j]] = eg.stamp;
+            }
+            for (int j = i + 1; j < d; j++) {
+                int b = eg.adj[v][j];
+                if (eg.mark[b] != eg.stamp) {
+                    eliminationAppend(&eg, a, b);
+                    eliminationAppend(&eg, b, a);
+                }
+            }
+        }
+        if (heuristic == MIN_DEGREE) {
+            for (int i = 0; i < d; i++) {
+                int a = eg.adj[v][i];
+                heapPush(&heap, eliminationCompact(&eg, a), a);
+            }
+        }
+    }
+
+    for (int v = 0; v < n; v++) free(eg.adj[v]);
+    free(eg.adj);
+    free(eg.size);
+    free(eg.cap);
+    free(eg.eliminated);
+    free(eg.mark);
+    free(original);
+    free(hasLoop);
+    free(origStart);
+    free(origAdj);
+    free(heap.items);
+
+    if (tooWide) {
+        freeDecomposition(td);
+        return NULL;
+    }
+    td->bagStart[n] = bagSize;
+
+    // the parent bag belongs to the member of N+ eliminated first
+    for (int step = 0; step < n; step++) {
+        td->parent[step] = -1;
+        for (int i = td->bagStart[step]; i < td->bagStart[step + 1]; i++) {
+            int r = td->rank[td->bag[i]];
+            if (td->parent[step] == -1 || r < td->parent[step]) {
+                td->parent[step] = r;
+            }
+        }
+    }
+    return td;
+}
+
+// Run the DP over the decomposition with vertex costs weights (NULL for unit
+// costs), fills cover by vertex id and returns its cost.
+// Bags are handled in elimination order so every child is done before its parent.
+int64_t decompositionVertexCover(Decomposition* td, const int64_t* weights, bool* cover) {
+    int n = td->numVertices;
+    int64_t** message = (int64_t**)calloc(n + 1, sizeof(int64_t*));  // min cover below the bag, per subset of N+
+    uint8_t** choice = (uint8_t**)calloc(n + 1, sizeof(uint8_t*)); // bit per subset: v taken
+    int* childHead = (int*)malloc((n + 1) * sizeof(int));
+    int* childNext = (int*)malloc((n + 1) * sizeof(int));
+    if (!message || !choice || !childHead || !childNext) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int step = 0; step < n; step++) {
+        childHead[step] = -1;
+    }
+    for (int step = 0; step < n; step++) {
+        int p = td->parent[step];
+        if (p != -1) {
+            childNext[step] = childHead[p];
+            childHead[p] = step;
+        }
+    }
+
+    // bit position of every member of the current bag: v is bit k, N+ are bits 0..k-1
+    int* slot = (int*)malloc((n + 1) * sizeof(int));
+    int* childMap = (int*)malloc((MAX_TREEWIDTH + 1) * sizeof(int));
+    if (!slot || !childMap) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    INSTR_PHASE_BEGIN(PHASE_SOLVE);
+    int64_t answer = 0;
+    for (int step = 0; step < n; step++) {
+        int v = td->order[step];
+        int k = td->bagStart[step + 1] - td->bagStart[step];
+        int* members = td->bag + td->bagStart[step];
+        for (int i = 0; i < k; i++) slot[members[i]] = i;
+        slot[v] = k;
+
+        // join: sum the child tables over the subsets of the bag {v} + N+
+        int full = 1 << (k + 1);
+        INSTR_COUNT(INSTR_NODES, full);
+        int64_t* joined = (int64_t*)calloc(full, sizeof(int64_t));
+        if (!joined) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        for (int c = childHead[step]; c != -1; c = childNext[c]) {
+            int ck = td->bagStart[c + 1] - td->bagStart[c];
+            int* childMembers = td->bag + td->bagStart[c];
+            for (int i = 0; i < ck; i++) childMap[i] = slot[childMembers[i]];
+            for (int subset = 0; subset < full; subset++) {
+                int index = 0;
+                for (int i = 0; i < ck; i++) {
+                    index |= ((subset >> childMap[i]) & 1) << i;
+                }
+                joined[subset] += message[c][index];
+            }
+            free(message[c]);
+            message[c] = NULL;
+        }
+
+        // introduce v with its original edges into N+, then forget it
+        int half = 1 << k;
+        message[step] = (int64_t*)malloc(half * sizeof(int64_t));
+        choice[step] = (uint8_t*)calloc(half / 8 + 1, sizeof(uint8_t));
+        if (!message[step] || !choice[step]) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        int required = td->originalMask[step];
+        for (int subset = 0; subset < half; subset++) {
+            int64_t taken = (weights ? weights[v] : 1) + joined[subset | half];
+            bool canSkip = !td->loop[step] && (subset & required) == required;
+            if (canSkip && joined[subset] <= taken) {
+                message[step][subset] = joined[subset];
+            } else {
+                message[step][subset] = taken;
+                choice[step][subset >> 3] |= 1 << (subset & 7);
+            }
+        }
+        free(joined);
+
+        if (td->parent[step] == -1) {
+            answer += message[step][0];
+            free(message[step]);
+            message[step] = NULL;
+        }
+    }
+
+    // walk back from the roots, N+ of a bag is decided before the bag itself
+    for (int step = n - 1; step >= 0; step--) {
+        int index = 0;
+        for (int i = td->bagStart[step]; i < td->bagStart[step + 1]; i++) {
+            if (cover[td->bag[i]]) index |= 1 << (i - td->bagStart[step]);
+        }
+        cover[td->order[step]] = (choice[step][index >> 3] >> (index & 7)) & 1;
+        free(choice[step]);
+    }
+
+    free(message);
+    free(choice);
+    free(childHead);
+    free(childNext);
+    free(slot);
+    free(childMap);
+    INSTR_PHASE_END(PHASE_SOLVE);
+    return answer;
+}
+
+// Exact cover through a tree decomposition. Both heuristics are tried when the
+// graph is small enough for min fill, the narrower decomposition is used.
+// Returns the cover cost under graph->weights, or -1 when no decomposition of
+// width <= maxWidth was found.
+int64_t treewidthVertexCover(Graph* graph, int maxWidth, bool* cover, int* width) {
+    INSTR_PHASE_BEGIN(PHASE_BUILD);
+    Decomposition* td = buildDecomposition(graph, MIN_DEGREE, maxWidth);
+    if (graph->numVertices <= MIN_FILL_LIMIT) {
+        Decomposition* fill = buildDecomposition(graph, MIN_FILL, td ? td->width : maxWidth);
+        if (fill && (!td || fill->width < td->width)) {
+            if (td) freeDecomposition(td);
+            td = fill;
+        } else if (fill) {
+            freeDecomposition(fill);
+        }
+    }
+    INSTR_PHASE_END(PHASE_BUILD);
+    if (!td) return -1;
+
+    *width = td->width;
+    int64_t cost = decompositionVertexCover(td, graph->weights, cover);
+    freeDecomposition(td);
+    return cost;
+}
+
+// graph351 as an edge list, it has cycles so the forest DP rejects it
+Graph* createGraph351Edges() {
+    Graph* graph = createGraph(7, 8);
+    addEdge(graph, 0, 1); // A-B
+    addEdge(graph, 1, 2); // B-C
+    addEdge(graph, 2, 3); // C-D
+    addEdge(graph, 2, 4); // C-E
+    addEdge(graph, 3, 4); // D-E
+    addEdge(graph, 3, 5); // D-F
+    addEdge(graph, 3, 6); // D-G
+    addEdge(graph, 4, 5); // E-F
+    return graph;
+}
+
+// graphConnected (complete graph with 7 vertices) as an edge list
+Graph* createGraphConnectedEdges() {
+    Graph* graph = createGraph(7, 21);
+    for (int i = 0; i < 7; i++) {
+        for (int j = i + 1; j < 7; j++) {
+            addEdge(graph, i, j);
+        }
+    }
+    return graph;
+}
+
+// path 0-1 with self loops on 1 and 2, the loops force both into the cover
+Graph* createSelfLoopEdges() {
+    Graph* graph = createGraph(3, 3);
+    addEdge(graph, 0, 1);
+    addEdge(graph, 1, 1);
+    addEdge(graph, 2, 2);
+    return graph;
+}
+
+// graphBipartite as an edge list
+Graph* createGraphBipartiteEdges() {
+    Graph* graph = createGraph(10, 9);
+    addEdge(graph, 0, 5); // A-F
+    addEdge(graph, 0, 6); // A-G
+    addEdge(graph, 1, 5); // B-F
+    addEdge(graph, 2, 7); // C-H
+    addEdge(graph, 2, 6); // C-G
+    addEdge(graph, 3, 7); // D-H
+    addEdge(graph, 3, 9); // D-J
+    addEdge(graph, 4, 8); // E-I
+    addEdge(graph, 4, 9); // E-J
+    return graph;
+}
+
+// graphBig as an edge list
+Graph* createGraphBigEdges() {
+    // Create a graph with 21 vertices (A through U, mapped as 0-20)
+    Graph* graph = createGraph(21, 88);
+    // Map letters to indices: A=0, B=1, C=2, D=3, E=4, F=5, G=6, H=7, I=8, J=9,
+    // K=10, L=11, M=12, N=13, O=14, P=15, Q=16, R=17, S=18, T=19, U=20
+
+    // Add edges for graphBig
+    // A's edges
+    addEdge(graph, 0, 1);  // A-B
+    addEdge(graph, 0, 4);  // A-E
+    addEdge(graph, 0, 3);  // A-D
+
+    // B's edges
+    addEdge(graph, 1, 0);  // B-A
+    addEdge(graph, 1, 4);  // B-E
+    addEdge(graph, 1, 5);  // B-F
+    addEdge(graph, 1, 2);  // B-C
+
+    // C's edges
+    addEdge(graph, 2, 1);  // C-B
+    addEdge(graph, 2, 5);  // C-F
+
+    // D's edges
+    addEdge(graph, 3, 0);  // D-A
+    addEdge(graph, 3, 4);  // D-E
+    addEdge(graph, 3, 7);  // D-H
+    addEdge(graph, 3, 6);  // D-G
+
+    // E's edges
+    addEdge(graph, 4, 3);  // E-D
+    addEdge(graph, 4, 0);  // E-A
+    addEdge(graph, 4, 1);  // E-B
+    addEdge(graph, 4, 5);  // E-F
+    addEdge(graph, 4, 8);  // E-I
+    addEdge(graph, 4, 7);  // E-H
+
+    // F's edges
+    addEdge(graph, 5, 4);  // F-E
+    addEdge(graph, 5, 1);  // F-B
+    addEdge(graph, 5, 2);  // F-C
+    addEdge(graph, 5, 8);  // F-I
+
+    // G's edges
+    addEdge(graph, 6, 3);  // G-D
+    addEdge(graph, 6, 7);  // G-H
+    addEdge(graph, 6, 10); // G-K
+    addEdge(graph, 6, 9);  // G-J
+
+    // H's edges
+    addEdge(graph, 7, 6);  // H-G
+    addEdge(graph, 7, 3);  // H-D
+    addEdge(graph, 7, 4);  // H-E
+    addEdge(graph, 7, 8);  // H-I
+    addEdge(graph, 7, 11); // H-L
+    addEdge(graph, 7, 10); // H-K
+
+    // I's edges
+    addEdge(graph, 8, 7);  // I-H
+    addEdge(graph, 8, 4);  // I-E
+    addEdge(graph, 8, 5);  // I-F
+    addEdge(graph, 8, 11); // I-L
+
+    // J's edges
+    addEdge(graph, 9, 6);  // J-G
+    addEdge(graph, 9, 10); // J-K
+    addEdge(graph, 9, 13); // J-N
+    addEdge(graph, 9, 12); // J-M
+
+    // K's edges
+    addEdge(graph, 10, 9);  // K-J
+    addEdge(graph, 10, 6);  // K-G
+    addEdge(graph, 10, 7);  // K-H
+    addEdge(graph, 10, 11); // K-L
+    addEdge(graph, 10, 14); // K-O
+    addEdge(graph, 10, 13); // K-N
+
+    // L's edges
+    addEdge(graph, 11, 10); // L-K
+    addEdge(graph, 11, 7);  // L-H
+    addEdge(graph, 11, 8);  // L-I
+    addEdge(graph, 11, 14); // L-O
+
+    // M's edges
+    addEdge(graph, 12, 9);  // M-J
+    addEdge(graph, 12, 13); // M-N
+    addEdge(graph, 12, 16); // M-Q
+    addEdge(graph, 12, 15); // M-P
+
+    // N's edges
+    addEdge(graph, 13, 12); // N-M
+    addEdge(graph, 13, 9);  // N-J
+    addEdge(graph, 13, 10); // N-K
+    addEdge(graph, 13, 14); // N-O
+    addEdge(graph, 13, 17); // N-R
+    addEdge(graph, 13, 16); // N-Q
+
+    // O's edges
+    addEdge(graph, 14, 13); // O-N
+    addEdge(graph, 14, 10); // O-K
+    addEdge(graph, 14, 11); // O-L
+    addEdge(graph, 14, 17); // O-R
+
+    // P's edges
+    addEdge(graph, 15, 12); // P-M
+    addEdge(graph, 15, 16); // P-Q
+    addEdge(graph, 15, 19); // P-T
+    addEdge(graph, 15, 18); // P-S
+
+    // Q's edges
+    addEdge(graph, 16, 15); // Q-P
+    addEdge(graph, 16, 12); // Q-M
+    addEdge(graph, 16, 13); // Q-N
+    addEdge(graph, 16, 17); // Q-R
+    addEdge(graph, 16, 20); // Q-U
+    addEdge(graph, 16, 19); // Q-T
+
+    // R's edges
+    addEdge(graph, 17, 16); // R-Q
+    addEdge(graph, 17, 13); // R-N
+    addEdge(graph, 17, 14); // R-O
+    addEdge(graph, 17, 20); // R-U
+
+    // S's edges
+    addEdge(graph, 18, 15); // S-P
+    addEdge(graph, 18, 19); // S-T
+
+    // T's edges
+    addEdge(graph, 19, 18); // T-S
+    addEdge(graph, 19, 15); // T-P
+    addEdge(graph, 19, 16); // T-Q
+    addEdge(graph, 19, 20); // T-U
+
+    // U's edges
+    addEdge(graph, 20, 19); // U-T
+    addEdge(graph, 20, 16); // U-Q
+    addEdge(graph, 20, 17); // U-R
+    return graph;
+}
+
+// the tree from createGraphBigTree as an edge list
+Graph* createGraphBigTreeEdges() {
+    Graph* graph = createGraph(21, 20);
+    for (int child = 1; child < 15; child++) {
+        addEdge(graph, (child - 1) / 2, child); // levels 1 to 3 are a complete binary tree
+    }
+    addEdge(graph, 7, 15);  // H-P
+    addEdge(graph, 7, 16);  // H-Q
+    addEdge(graph, 8, 17);  // I-R
+    addEdge(graph, 8, 18);  // I-S
+    addEdge(graph, 9, 19);  // J-T
+    addEdge(graph, 9, 20);  // J-U
+    return graph;
+}
+
+// graphBig tree where a vertex costs 1 + its id mod 5, so cheap leaves can beat their parents
+Graph* createWeightedTreeEdges() {
+    Graph* graph = createGraphBigTreeEdges();
+    for (int v = 0; v < graph->numVertices; v++) {
+        setVertexWeight(graph, v, 1 + v % 5);
+    }
+    return graph;
+}
+
+// graph351 with a cost on every vertex, the same costs as in greedy.c and bruteforce_solution.c
+Graph* createWeightedGraph351Edges() {
+    static const int64_t costs[7] = {3, 1, 4, 2, 5, 1, 1};
+    Graph* graph = createGraph351Edges();
+    for (int v = 0; v < 7; v++) {
+        setVertexWeight(graph, v, costs[v]);
+    }
+    return graph;
+}
+
+// a root with 1000 children that have 3 leaves each
+Graph* createWideTreeEdges() {
+    int n = 1 + 1000 + 3000;
+    Graph* graph = createGraph(n, n - 1);
+    for (int child = 1; child <= 1000; child++) {
+        addEdge(graph, 0, child);
+        for (int leaf = 0; leaf < 3; leaf++) {
+            addEdge(graph, child, 1001 + 3 * (child - 1) + leaf);
+        }
+    }
+    return graph;
+}
+
+// a path of a million vertices, far deeper than a recursive DP can go
+Graph* createDeepPathEdges() {
+    int n = 1000000;
+    Graph* graph = createGraph(n, n - 1);
+    for (int v = 0; v + 1 < n; v++) {
+        addEdge(graph, v, v + 1);
+    }
+    return graph;
+}
+
+// Function to time a forest test on an edge list graph
+double timeForestTest(Graph* (*createGraphFunc)(), const char* graphName) {
+    clock_t start, end;
+    double cpu_time_used;
+
+    start = clock();
+
+    Graph* graph = createGraphFunc();
+    Forest* forest = buildForest(graph);
+    if (forest) {
+        bool* cover = (bool*)calloc(graph->numVertices + 1, sizeof(bool));
+        if (!cover) {
+            perror("Memory allocation failed");
+            exit(EXIT_FAILURE);
+        }
+        int64_t cost = forestVertexCover(forest, graph->weights, cover);
+        printf("Minimum Vertex Cover %s for %s: %lld\n", graph->weights ? "Cost" : "Size", graphName, (long long)cost);
+        if (graph->numVertices <= 100) {
+            printf("Vertices in Minimum Cover: ");
+            for (int v = 0; v < graph->numVertices; v++) {
+                if (cover[v]) printf("%d ", v);
+            }
+            printf("\n");
+        }
+        free(cover);
+        freeForest(forest);
+    } else {
+        printf("%s is not a forest\n", graphName);
+    }
+    freeGraph(graph);
+
+    end = clock();
+
+    cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
+    return cpu_time_used;
+}
+
+// Function to time a tree decomposition test on an edge list graph
+double timeTreewidthTest(Graph* (*createGraphFunc)(), const char* graphName) {
+    clock_t start, end;
+    double cpu_time_used;
+
+    start = clock();
+
+    Graph* graph = createGraphFunc();
+    bool* cover = (bool*)calloc(graph->numVertices + 1, sizeof(bool));
+    if (!cover) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int width;
+    int64_t cost = treewidthVertexCover(graph, MAX_TREEWIDTH, cover, &width);
+    if (cost >= 0) {
+        printf("Minimum Vertex Cover %s for %s: %lld (treewidth at most %d)\n", graph->weights ? "Cost" : "Size",
+               graphName, (long long)cost, width);
+        printf("Vertices in Minimum Cover: ");
+        for (int v = 0; v < graph->numVertices; v++) {
+            if (cover[v]) printf("%d ", v);
+        }
+        printf("\n");
+    } else {
+        printf("%s has no decomposition of width <= %d\n", graphName, MAX_TREEWIDTH);
+    }
+    free(cover);
+    freeGraph(graph);
+
+    end = clock();
+
+    cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
+    return cpu_time_used;
+}
+
+// Function to time a test
+double timeTest(Node* (*createTreeFunc)(), const char* graphName) {
+    clock_t start, end;
+    double cpu_time_used;
+    
+    start = clock();
+    
+    Node* root = createTreeFunc();
+    int64_t minCover = minVertexCover(root, NULL);
+    printf("Minimum Vertex Cover Size for %s: %lld\n", graphName, (long long)minCover);
+    freeTree(root);
+    
+    end = clock();
+    
+    cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
+    return cpu_time_used;
+}
+
+// benchmark wrappers, both return NULL when the graph is outside what the DP handles
+bool* benchForestCover(Graph* graph) {
+    INSTR_PHASE_BEGIN(PHASE_BUILD);
+    Forest* forest = buildForest(graph);
+    INSTR_PHASE_END(PHASE_BUILD);
+    if (!forest) return NULL;
+    bool* cover = (bool*)calloc(graph->numVertices + 1, sizeof(bool));
+    if (!cover) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    forestVertexCover(forest, graph->weights, cover);
+    freeForest(forest);
+    return cover;
+}
+
+bool* benchTreewidthCover(Graph* graph) {
+    bool* cover = (bool*)calloc(graph->numVertices + 1, sizeof(bool));
+    if (!cover) {
+        perror("Memory allocation failed");
+        exit(EXIT_FAILURE);
+    }
+    int width;
+    if (treewidthVertexCover(graph, MAX_TREEWIDTH, cover, &width) < 0) {
+        free(cover);
+        return NULL;
+    }
+    return cover;
+}
+
+BenchSolver benchSolvers[] = {
+    {"forest-dp", benchForestCover, 0},
+    {"treewidth-dp", benchTreewidthCover, 0},
+};
+
+//main program
+int main(int argc, char* argv[]) {
+    double time_used;
+
+    // --stats <file> anywhere dumps the instrumentation counters at exit
+    instrumentStatsOption(&argc, argv, "vertexCoverDP");
+
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        return runBenchmarks("vertexCoverDP", benchSolvers, 2, argc - 2, argv + 2);
+    }
+    
+    printf("Testing graph351...\n");
+    time_used = timeTest(createGraph351Tree, "graph351");
+    printf("Time taken for graph351: %.6f seconds\n\n", time_used);
+    
+    printf("Testing graphConnected...\n");
+    time_used = timeTest(createGraphConnectedTree, "graphConnected");
+    printf("Time taken for graphConnected: %.6f seconds\n\n", time_used);
+    
+    printf("Testing graphBipartite...\n");
+    time_used = timeTest(createGraphBipartiteTree, "graphBipartite");
+    printf("Time taken for graphBipartite: %.6f seconds\n\n", time_used);
+    
+    printf("Testing graphBig...\n");
+    time_used = timeTest(createGraphBigTree, "graphBig");
+    printf("Time taken for graphBig: %.6f seconds\n\n", time_used);
+
+    printf("Testing graph351 as an edge list...\n");
+    time_used = timeForestTest(createGraph351Edges, "graph351");
+    printf("Time taken for graph351: %.6f seconds\n\n", time_used);
+
+    printf("Testing graphBig tree as an edge list...\n");
+    time_used = timeForestTest(createGraphBigTreeEdges, "graphBigTree");
+    printf("Time taken for graphBigTree: %.6f seconds\n\n", time_used);
+
+    printf("Testing wideTree...\n");
+    time_used = timeForestTest(createWideTreeEdges, "wideTree");
+    printf("Time taken for wideTree: %.6f seconds\n\n", time_used);
+
+    printf("Testing weightedTree...\n");
+    time_used = timeForestTest(createWeightedTreeEdges, "weightedTree");
+    printf("Time taken for weightedTree: %.6f seconds\n\n", time_used);
+
+    printf("Testing deepPath...\n");
+    time_used = timeForestTest(createDeepPathEdges, "deepPath");
+    printf("Time taken for deepPath: %.6f seconds\n\n", time_used);
+
+    printf("Testing graph351 by tree decomposition...\n");
+    time_used = timeTreewidthTest(createGraph351Edges, "graph351");
+    printf("Time taken for graph351: %.6f seconds\n\n", time_used);
+
+    printf("Testing graphConnected by tree decomposition...\n");
+    time_used = timeTreewidthTest(createGraphConnectedEdges, "graphConnected");
+    printf("Time taken for graphConnected: %.6f seconds\n\n", time_used);
+
+    printf("Testing graphBipartite by tree decomposition...\n");
+    time_used = timeTreewidthTest(createGraphBipartiteEdges, "graphBipartite");
+    printf("Time taken for graphBipartite: %.6f seconds\n\n", time_used);
+
+    printf("Testing graphBig by tree decomposition...\n");
+    time_used = timeTreewidthTest(createGraphBigEdges, "graphBig");
+    printf("Time taken for graphBig: %.6f seconds\n\n", time_used);
+
+    printf("Testing weighted graph351 by tree decomposition...\n");
+    time_used = timeTreewidthTest(createWeightedGraph351Edges, "weightedGraph351");
+    printf("Time taken for weightedGraph351: %.6f seconds\n\n", time_used);
+
+    printf("Testing selfLoops by tree decomposition...\n");
+    time_used = timeTreewidthTest(createSelfLoopEdges, "selfLoops");
+    printf("Time taken for selfLoops: %.6f seconds\n", time_used);
+    
+    return 0;
 }
\ No newline at end of file